@@ -2,10 +2,10 @@
  * PosixHelperFunctions.c
  *
  *       Created on:  Mar 10, 2015
- *  Last Updated on:  Nov 04, 2025
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2025 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -963,6 +963,41 @@ int setCustomBaudRate(int portFD, baud_rate baudRate)
 	return retVal;
 }
 
+int setUsbLatencyTimer(const char *portFile, int latencyTimer)
+{
+	// Resolve the underlying TTY device name in case the port path is a symlink
+	int actualLatencyTimer = -1;
+	char *devicePath = realpath(portFile, NULL);
+	if (!devicePath)
+		return actualLatencyTimer;
+	char *latencyTimerFile = (char*)malloc(strlen(devicePath) + 48);
+	if (!latencyTimerFile)
+	{
+		free(devicePath);
+		return actualLatencyTimer;
+	}
+	sprintf(latencyTimerFile, "/sys/class/tty/%s/device/latency_timer", 1 + strrchr(devicePath, '/'));
+
+	// Attempt to write the requested latency timer value, if any
+	FILE *latencyFile;
+	if ((latencyTimer > 0) && ((latencyFile = fopen(latencyTimerFile, "w")) != NULL))
+	{
+		fprintf(latencyFile, "%d", latencyTimer);
+		fclose(latencyFile);
+	}
+
+	// Read back the latency timer value actually in effect
+	if ((latencyFile = fopen(latencyTimerFile, "r")) != NULL)
+	{
+		if (fscanf(latencyFile, "%d", &actualLatencyTimer) != 1)
+			actualLatencyTimer = -1;
+		fclose(latencyFile);
+	}
+	free(latencyTimerFile);
+	free(devicePath);
+	return actualLatencyTimer;
+}
+
 // Solaris-specific functionality
 #elif defined(__sun__)
 
@@ -2,10 +2,10 @@
  * PosixHelperFunctions.h
  *
  *       Created on:  Mar 10, 2015
- *  Last Updated on:  Nov 02, 2025
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2025 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -30,15 +30,45 @@
 #include <pthread.h>
 #include "com_fazecast_jSerialComm_SerialPort.h"
 
+// Modem line edge capture structure
+#define MODEM_LINE_EDGE_RING_SIZE 128
+typedef struct modemLineEdge
+{
+	long long timestamp;
+	int line, asserted;
+} modemLineEdge;
+
+// Half-duplex echo collision structure
+#define ECHO_HISTORY_SIZE 4096
+#define ECHO_COLLISION_RING_SIZE 64
+typedef struct echoCollision
+{
+	long long timestamp;
+	unsigned char expected, received;
+} echoCollision;
+
 // Serial port data structure
+#define RS485_HISTOGRAM_BUCKETS 20
 typedef struct serialPort
 {
 	pthread_mutex_t eventMutex;
 	pthread_cond_t eventReceived;
-	pthread_t eventsThread1, eventsThread2;
+	pthread_t eventsThread1, eventsThread2, modemLineCaptureThread;
+	modemLineEdge modemLineEdges[MODEM_LINE_EDGE_RING_SIZE];
+	volatile unsigned int modemLineEdgesHead, modemLineEdgesTail, modemLineEdgesLost;
+	volatile int modemLineCaptureMask;
+	echoCollision echoCollisions[ECHO_COLLISION_RING_SIZE];
+	unsigned char echoHistory[ECHO_HISTORY_SIZE];
+	volatile unsigned int echoHistoryHead, echoHistoryTail, echoCollisionsHead, echoCollisionsTail;
+	volatile long long echoDeadline, echoTimeoutNanos, echoBytesCancelled, echoCollisionsLost;
 	char *portPath, *friendlyName, *portDescription, *portLocation;
 	char *serialNumber, *manufacturer, *deviceDriver, isSymlink;
 	int errorLineNumber, errorNumber, handle, eventsMask, event, vendorID, productID;
+	volatile long long dataReadyTimestamp, lastReadTimestamp, lastBusActivityTimestamp;
+	volatile long long bytesRead, bytesWritten, readCalls, writeCalls;
+	long long characterTimeNanos, rs485Statistics[4 + (2 * RS485_HISTOGRAM_BUCKETS)];
+	int rs485DelayBefore, rs485DelayAfter;
+	char rs485SoftwareControl, rs485ActiveHigh, echoCancellation;
 	volatile char enumerated, eventListenerRunning, eventListenerUsesThreads;
 } serialPort;
 
@@ -73,6 +103,8 @@ extern int ioctl(int __fd, int __request, ...);
 extern int ioctl(int __fd, unsigned long int __request, ...);
 #endif
 
+int setUsbLatencyTimer(const char *portFile, int latencyTimer);
+
 
 // Solaris-specific functionality
 #elif defined(__sun__)
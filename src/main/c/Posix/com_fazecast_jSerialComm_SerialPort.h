@@ -73,8 +73,26 @@ extern "C" {
 #define com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR 8388608L
 #undef com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_PARITY_ERROR
 #define com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_PARITY_ERROR 16777216L
+#undef com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_COLLISION
+#define com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_COLLISION 33554432L
 #undef com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_PORT_DISCONNECTED
 #define com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_PORT_DISCONNECTED 268435456L
+#undef com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_DEFAULT
+#define com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_DEFAULT 0L
+#undef com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_LOW_LATENCY
+#define com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_LOW_LATENCY 1L
+#undef com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_BALANCED
+#define com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_BALANCED 2L
+#undef com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_THROUGHPUT
+#define com_fazecast_jSerialComm_SerialPort_LATENCY_PROFILE_THROUGHPUT 3L
+#undef com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_BLOCK
+#define com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_BLOCK 0L
+#undef com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_DROP_OLDEST
+#define com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_DROP_OLDEST 1L
+#undef com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_DROP_NEWEST
+#define com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_DROP_NEWEST 2L
+#undef com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_COALESCE
+#define com_fazecast_jSerialComm_SerialPort_RECEIVE_QUEUE_COALESCE 3L
 /*
  * Class:     com_fazecast_jSerialComm_SerialPort
  * Method:    uninitializeLibrary
@@ -187,6 +205,54 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeBytes
 JNIEXPORT void JNICALL Java_com_fazecast_jSerialComm_SerialPort_setEventListeningStatus
   (JNIEnv *, jobject, jlong, jboolean);
 
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    setModemLineCaptureStatus
+ * Signature: (JI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_setModemLineCaptureStatus
+  (JNIEnv *, jobject, jlong, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    readModemLineEdges
+ * Signature: (J[J[I[I)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readModemLineEdges
+  (JNIEnv *, jobject, jlong, jlongArray, jintArray, jintArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getLostModemLineEdges
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLostModemLineEdges
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    readEchoCollisions
+ * Signature: (J[J[B[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readEchoCollisions
+  (JNIEnv *, jobject, jlong, jlongArray, jbyteArray, jbyteArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getLostEchoCollisions
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLostEchoCollisions
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getCancelledEchoBytes
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getCancelledEchoBytes
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_fazecast_jSerialComm_SerialPort
  * Method:    setBreak
@@ -299,6 +365,142 @@ JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_getRI
 JNIEXPORT void JNICALL Java_com_fazecast_jSerialComm_SerialPort_quickConfig
   (JNIEnv *, jobject, jlong, jint, jint, jint);
 
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getLastReadTimestamp
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLastReadTimestamp
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getLineStatistics
+ * Signature: (J[J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLineStatistics
+  (JNIEnv *, jobject, jlong, jlongArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    getRs485Statistics
+ * Signature: (J[J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_getRs485Statistics
+  (JNIEnv *, jobject, jlong, jlongArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    waitForIdleGap
+ * Signature: (JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_waitForIdleGap
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    writeModbusFrame
+ * Signature: (J[BIJ)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeModbusFrame
+  (JNIEnv *, jobject, jlong, jbyteArray, jint, jlong);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    readModbusFrame
+ * Signature: (J[BIJJI)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readModbusFrame
+  (JNIEnv *, jobject, jlong, jbyteArray, jint, jlong, jlong, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    findDelimiters
+ * Signature: ([BII[B[I)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findDelimiters
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jbyteArray, jintArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    encodeSlip
+ * Signature: ([BII[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeSlip
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jbyteArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    decodeSlip
+ * Signature: ([BII)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeSlip
+  (JNIEnv *, jclass, jbyteArray, jint, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    encodeHdlc
+ * Signature: ([BIIII[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeHdlc
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jint, jint, jbyteArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    decodeHdlc
+ * Signature: ([BIIII)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jint, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    updateCrc
+ * Signature: ([IZI[BII)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_updateCrc
+  (JNIEnv *, jclass, jintArray, jboolean, jint, jbyteArray, jint, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    updateCrcDirect
+ * Signature: ([IZILjava/nio/ByteBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_updateCrcDirect
+  (JNIEnv *, jclass, jintArray, jboolean, jint, jobject, jint, jint);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    findPatterns
+ * Signature: ([I[BIII[I[I)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findPatterns
+  (JNIEnv *, jclass, jintArray, jbyteArray, jint, jint, jint, jintArray, jintArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    findLengthFieldFrames
+ * Signature: ([BII[B[I[I[I)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findLengthFieldFrames
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jbyteArray, jintArray, jintArray, jintArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    encodeCobs
+ * Signature: ([BII[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeCobs
+  (JNIEnv *, jclass, jbyteArray, jint, jint, jbyteArray);
+
+/*
+ * Class:     com_fazecast_jSerialComm_SerialPort
+ * Method:    decodeCobs
+ * Signature: ([BII)I
+ */
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeCobs
+  (JNIEnv *, jclass, jbyteArray, jint, jint);
+
 /*
  * Class:     com_fazecast_jSerialComm_SerialPort
  * Method:    getLastErrorLocation
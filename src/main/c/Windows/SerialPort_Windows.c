@@ -2,10 +2,10 @@
  * SerialPort_Windows.c
  *
  *       Created on:  Feb 25, 2012
- *  Last Updated on:  Nov 02, 2025
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2025 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -71,8 +71,13 @@ jfieldID sendDeviceQueueSizeField;
 jfieldID receiveDeviceQueueSizeField;
 jfieldID requestElevatedPermissionsField;
 jfieldID rs485ModeField;
+jfieldID rs485ActiveHighField;
 jfieldID rs485DelayBeforeField;
 jfieldID rs485DelayAfterField;
+jfieldID rs485SoftwareControlField;
+jfieldID echoCancellationField;
+jfieldID echoTimeoutField;
+jfieldID lastCollisionTimestampField;
 jfieldID xonStartCharField;
 jfieldID xoffStopCharField;
 jfieldID timeoutModeField;
@@ -88,8 +93,13 @@ typedef int (__stdcall *FT_GetDeviceInfoListFunction)(FT_DEVICE_LIST_INFO_NODE*,
 typedef int (__stdcall *FT_EEPROM_ReadFunction)(FT_HANDLE, void*, DWORD, char*, char*, char*, char*);
 typedef BOOL (__stdcall *SetupDiGetDevicePropertyWFunction)(HDEVINFO, PSP_DEVINFO_DATA, const DEVPROPKEY*, DEVPROPTYPE*, PBYTE, DWORD, PDWORD, DWORD);
 typedef BOOL (__stdcall *CancelIoExFunction)(HANDLE, LPOVERLAPPED);
+typedef HANDLE (__stdcall *CreateWaitableTimerExWFunction)(LPSECURITY_ATTRIBUTES, LPCWSTR, DWORD, DWORD);
 SetupDiGetDevicePropertyWFunction SetupDiGetDevicePropertyW = NULL;
 CancelIoExFunction CancelIoEx = NULL;
+CreateWaitableTimerExWFunction CreateWaitableTimerExW = NULL;
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 // Global list of available serial ports
 char portsEnumerated = 0;
@@ -115,6 +125,121 @@ static inline jboolean checkJniError(JNIEnv *env, int lineNumber)
 	return JNI_FALSE;
 }
 
+// Monotonic clock timestamp function
+static inline long long getMonotonicTimestamp(void)
+{
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return ((counter.QuadPart / frequency.QuadPart) * 1000000000LL) + (((counter.QuadPart % frequency.QuadPart) * 1000000000LL) / frequency.QuadPart);
+}
+
+// Half-duplex echo cancellation functions
+static unsigned int recordEchoHistory(serialPort *port, const jbyte *data, int length)
+{
+	// Record the bytes about to be transmitted before writing them, since their echo may arrive before the write returns
+	unsigned int head = port->echoHistoryHead, tail = port->echoHistoryTail;
+	if (length > (int)(ECHO_HISTORY_SIZE - (head - tail)))
+		length = (int)(ECHO_HISTORY_SIZE - (head - tail));
+	for (int i = 0; i < length; ++i)
+		port->echoHistory[(head + i) % ECHO_HISTORY_SIZE] = (unsigned char)data[i];
+	port->echoDeadline = getMonotonicTimestamp() + ((head + length - tail) * port->characterTimeNanos) + port->echoTimeoutNanos;
+	MemoryBarrier();
+	port->echoHistoryHead = head + length;
+	return head;
+}
+
+static void completeEchoHistory(serialPort *port, unsigned int previousHead, int numBytesWritten)
+{
+	// Forget any recorded bytes that were not actually written, then restart the echo timeout from the end of the write
+	unsigned int head = port->echoHistoryHead, tail = port->echoHistoryTail;
+	if ((head - previousHead) > (unsigned int)((numBytesWritten > 0) ? numBytesWritten : 0))
+	{
+		head = previousHead + ((numBytesWritten > 0) ? numBytesWritten : 0);
+		if ((int)(head - tail) < 0)
+			head = tail;
+		MemoryBarrier();
+		port->echoHistoryHead = head;
+	}
+	port->echoDeadline = getMonotonicTimestamp() + ((head - tail) * port->characterTimeNanos) + port->echoTimeoutNanos;
+}
+
+static inline void discardEchoHistory(serialPort *port)
+{
+	MemoryBarrier();
+	port->echoHistoryTail = port->echoHistoryHead;
+}
+
+static void pushEchoCollision(serialPort *port, long long timestamp, unsigned char expected, unsigned char received)
+{
+	// Store the collision in the single-producer, single-consumer ring if there is room
+	unsigned int head = port->echoCollisionsHead;
+	if ((head - port->echoCollisionsTail) >= ECHO_COLLISION_RING_SIZE)
+		port->echoCollisionsLost++;
+	else
+	{
+		echoCollision *collision = &port->echoCollisions[head % ECHO_COLLISION_RING_SIZE];
+		collision->timestamp = timestamp;
+		collision->expected = expected;
+		collision->received = received;
+		MemoryBarrier();
+		port->echoCollisionsHead = head + 1;
+	}
+}
+
+static BOOL observeEchoQueue(serialPort *port)
+{
+	// Pending echo is only known to be missing, such as when the receiver is disabled while transmitting, once the receive queue is observed empty after its deadline
+	COMSTAT commInfo;
+	unsigned int head = port->echoHistoryHead;
+	MemoryBarrier();
+	if (!ClearCommError(port->handle, NULL, &commInfo) || commInfo.cbInQue)
+		return FALSE;
+	if ((port->echoHistoryTail != head) && (getMonotonicTimestamp() > port->echoDeadline))
+	{
+		MemoryBarrier();
+		port->echoHistoryTail = head;
+	}
+	return TRUE;
+}
+
+static int cancelEcho(serialPort *port, jbyte *data, int length, long long arrivalTimestamp, long long *collisionTimestamp)
+{
+	// Return immediately if no transmitted bytes are awaiting their echo
+	unsigned int tail = port->echoHistoryTail, head = port->echoHistoryHead;
+	MemoryBarrier();
+	if ((tail == head) || (length <= 0))
+		return length;
+
+	// Data can only be excluded from the echo based on when it was actually observed to arrive, which is unknown if it was already waiting before the read
+	long long timestamp = port->dataReadyTimestamp ? port->dataReadyTimestamp : arrivalTimestamp;
+	if (timestamp > port->echoDeadline)
+	{
+		port->echoHistoryTail = head;
+		return length;
+	}
+	else if (!timestamp)
+		timestamp = getMonotonicTimestamp();
+
+	// On a half-duplex bus, every byte received while awaiting an echo occupies the slot of a transmitted byte, so strip it and report a collision if the two differ
+	int numBytesCancelled = 0;
+	while ((numBytesCancelled < length) && (tail != head))
+	{
+		unsigned char expected = port->echoHistory[tail++ % ECHO_HISTORY_SIZE], received = (unsigned char)data[numBytesCancelled++];
+		if (expected != received)
+		{
+			pushEchoCollision(port, timestamp, expected, received);
+			*collisionTimestamp = timestamp;
+		}
+	}
+	MemoryBarrier();
+	port->echoHistoryTail = tail;
+	port->echoBytesCancelled += numBytesCancelled;
+	if (numBytesCancelled < length)
+		memmove(data, data + numBytesCancelled, length - numBytesCancelled);
+	return length - numBytesCancelled;
+}
+
 // Generalized port enumeration function
 static void enumeratePorts(JNIEnv *env)
 {
@@ -677,10 +802,20 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved)
 	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
 	rs485ModeField = (*env)->GetFieldID(env, serialCommClass, "rs485Mode", "Z");
 	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
+	rs485ActiveHighField = (*env)->GetFieldID(env, serialCommClass, "rs485ActiveHigh", "Z");
+	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
 	rs485DelayBeforeField = (*env)->GetFieldID(env, serialCommClass, "rs485DelayBefore", "I");
 	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
 	rs485DelayAfterField = (*env)->GetFieldID(env, serialCommClass, "rs485DelayAfter", "I");
 	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
+	rs485SoftwareControlField = (*env)->GetFieldID(env, serialCommClass, "rs485SoftwareControl", "Z");
+	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
+	echoCancellationField = (*env)->GetFieldID(env, serialCommClass, "echoCancellation", "Z");
+	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
+	echoTimeoutField = (*env)->GetFieldID(env, serialCommClass, "echoTimeout", "I");
+	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
+	lastCollisionTimestampField = (*env)->GetFieldID(env, serialCommClass, "lastCollisionTimestamp", "J");
+	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
 	xonStartCharField = (*env)->GetFieldID(env, serialCommClass, "xonStartChar", "B");
 	if (checkJniError(env, __LINE__ - 1)) return JNI_ERR;
 	xoffStopCharField = (*env)->GetFieldID(env, serialCommClass, "xoffStopChar", "B");
@@ -700,7 +835,10 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *reserved)
 	if (setupApiInstance != NULL)
 		SetupDiGetDevicePropertyW = (SetupDiGetDevicePropertyWFunction)GetProcAddress(setupApiInstance, "SetupDiGetDevicePropertyW");
 	if (kernelInstance != NULL)
+	{
 		CancelIoEx = (CancelIoExFunction)GetProcAddress(kernelInstance, "CancelIoEx");
+		CreateWaitableTimerExW = (CreateWaitableTimerExWFunction)GetProcAddress(kernelInstance, "CreateWaitableTimerExW");
+	}
 
 	// Initialize the critical section lock
 	InitializeCriticalSection(&criticalSection);
@@ -905,6 +1043,11 @@ JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_openPortNative(
 		// Set the newly opened port handle in the serial port structure
 		EnterCriticalSection(&criticalSection);
 		port->handle = portHandle;
+		port->bytesRead = port->bytesWritten = port->readCalls = port->writeCalls = 0;
+		memset(port->rs485Statistics, 0, sizeof(port->rs485Statistics));
+		port->echoHistoryHead = port->echoHistoryTail = port->echoCollisionsHead = port->echoCollisionsTail = 0;
+		port->echoBytesCancelled = port->echoCollisionsLost = 0;
+		port->pendingCommEvents = 0;
 		LeaveCriticalSection(&criticalSection);
 
 		// Quickly set the desired RTS/DTR line status immediately upon opening
@@ -969,6 +1112,18 @@ JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_configPort(J
 	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
 	BYTE rs485ModeEnabled = (BYTE)(*env)->GetBooleanField(env, obj, rs485ModeField);
 	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	BYTE rs485ActiveHigh = (BYTE)(*env)->GetBooleanField(env, obj, rs485ActiveHighField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	BYTE rs485SoftwareControl = (BYTE)(*env)->GetBooleanField(env, obj, rs485SoftwareControlField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	BYTE echoCancellation = (BYTE)(*env)->GetBooleanField(env, obj, echoCancellationField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	int echoTimeout = (*env)->GetIntField(env, obj, echoTimeoutField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	int rs485DelayBefore = (*env)->GetIntField(env, obj, rs485DelayBeforeField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	int rs485DelayAfter = (*env)->GetIntField(env, obj, rs485DelayAfterField);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
 	BYTE isDtrEnabled = (*env)->GetBooleanField(env, obj, isDtrEnabledField);
 	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
 	BYTE isRtsEnabled = (*env)->GetBooleanField(env, obj, isRtsEnabledField);
@@ -981,7 +1136,7 @@ JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_configPort(J
 	BOOL DSREnabled = (((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_DSR_ENABLED) > 0) ||
 			((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_DTR_ENABLED) > 0));
 	BYTE DTRValue = ((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_DTR_ENABLED) > 0) ? DTR_CONTROL_HANDSHAKE : (isDtrEnabled ? DTR_CONTROL_ENABLE : DTR_CONTROL_DISABLE);
-	BYTE RTSValue = (rs485ModeEnabled ? RTS_CONTROL_TOGGLE :
+	BYTE RTSValue = ((rs485ModeEnabled && rs485SoftwareControl) ? (rs485ActiveHigh ? RTS_CONTROL_DISABLE : RTS_CONTROL_ENABLE) : rs485ModeEnabled ? RTS_CONTROL_TOGGLE :
 			(((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_RTS_ENABLED) > 0) ? RTS_CONTROL_HANDSHAKE : (isRtsEnabled ? RTS_CONTROL_ENABLE : RTS_CONTROL_DISABLE)));
 	BOOL XonXoffInEnabled = ((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_XONXOFF_IN_ENABLED) > 0);
 	BOOL XonXoffOutEnabled = ((flowControl & com_fazecast_jSerialComm_SerialPort_FLOW_CONTROL_XONXOFF_OUT_ENABLED) > 0);
@@ -1054,6 +1209,20 @@ JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_configPort(J
 		(*env)->SetBooleanField(env, obj, rs485ModeField, dcbSerialParams.fRtsControl == RTS_CONTROL_TOGGLE);
 	}
 
+	// Store the software RS-485 direction control parameters
+	int stopBitsCount = (stopBitsInt == com_fazecast_jSerialComm_SerialPort_TWO_STOP_BITS) ? 20 : (stopBitsInt == com_fazecast_jSerialComm_SerialPort_ONE_POINT_FIVE_STOP_BITS) ? 15 : 10;
+	port->characterTimeNanos = (baudRate > 0) ? (((10LL + (10LL * byteSize) + (isParity ? 10LL : 0LL) + stopBitsCount) * 100000000LL) / baudRate) : 0;
+	port->rs485DelayBefore = rs485DelayBefore;
+	port->rs485DelayAfter = rs485DelayAfter;
+	port->rs485ActiveHigh = rs485ActiveHigh ? 1 : 0;
+	port->rs485SoftwareControl = (rs485ModeEnabled && rs485SoftwareControl) ? 1 : 0;
+
+	// Store the half-duplex echo cancellation parameters, forgetting any pending echo if cancellation is being disabled
+	port->echoTimeoutNanos = echoTimeout * 1000000LL;
+	if (!echoCancellation)
+		discardEchoHistory(port);
+	port->echoCancellation = echoCancellation ? 1 : 0;
+
 	// Get event flags from the Java class
 	int eventFlags = EV_ERR;
 	if ((eventsToMonitor & com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_DATA_AVAILABLE) || (eventsToMonitor & com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_DATA_RECEIVED))
@@ -1127,6 +1296,7 @@ JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_flushRxTxBuf
 		port->errorNumber = GetLastError();
 		return JNI_FALSE;
 	}
+	discardEchoHistory(port);
 	return JNI_TRUE;
 }
 
@@ -1145,9 +1315,10 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_waitForEvent(JNI
 		return event;
 	}
 
-	// Wait for a serial port event
-	DWORD eventMask = 0, errorMask = 0, waitValue, numBytesTransferred;
-	if (!WaitCommEvent(port->handle, &eventMask, &overlappedStruct))
+	// Wait for a serial port event, first reporting any events that were consumed while waiting for an idle gap
+	DWORD eventMask = port->pendingCommEvents, errorMask = 0, waitValue, numBytesTransferred;
+	port->pendingCommEvents = 0;
+	if (!eventMask && !WaitCommEvent(port->handle, &eventMask, &overlappedStruct))
 	{
 		if ((GetLastError() == ERROR_IO_PENDING) || (GetLastError() == ERROR_INVALID_PARAMETER))
 		{
@@ -1194,7 +1365,11 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_waitForEvent(JNI
 	if (eventMask & EV_TXEMPTY)
 		event |= com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_DATA_WRITTEN;
 	if ((eventMask & EV_RXCHAR) && (commInfo.cbInQue > 0))
+	{
 		event |= com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_DATA_AVAILABLE;
+		if (!port->dataReadyTimestamp)
+			port->dataReadyTimestamp = getMonotonicTimestamp();
+	}
 	if (eventMask & EV_CTS)
 		event |= com_fazecast_jSerialComm_SerialPort_LISTENING_EVENT_CTS;
 	if (eventMask & EV_DSR)
@@ -1296,18 +1471,63 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readBytes(JNIEnv
 		return -1;
 	}
 
-	// Read from the serial port
-	BOOL result;
-	DWORD numBytesRead = 0;
-	if (((result = ReadFile(port->handle, readBuffer + offset, bytesToRead, NULL, &overlappedStruct)) == FALSE) && (GetLastError() != ERROR_IO_PENDING))
+	// Read from the serial port, noting whether any returned data must have arrived during this call
+	BOOL result, echoArrivalObserved = port->echoCancellation ? observeEchoQueue(port) : FALSE;
+	BOOL blocking = ((timeoutMode & com_fazecast_jSerialComm_SerialPort_TIMEOUT_READ_BLOCKING) > 0);
+	DWORD numBytesRead = 0, numBytesReadTotal = 0, numBytesStripped = 0, waitValue = WAIT_OBJECT_0;
+	long long collisionTimestamp = 0, remainingNanos = 0, deadline = getMonotonicTimestamp() + (1000000LL * readTimeout);
+	do
 	{
-		port->errorLineNumber = __LINE__ - 2;
-		port->errorNumber = GetLastError();
+		// Blocking reads must keep waiting for any bytes whose place was taken by stripped echo, but only for whatever remains of the original timeout
+		++port->readCalls;
+		numBytesRead = 0;
+		waitValue = WAIT_OBJECT_0;
+		if (((result = ReadFile(port->handle, readBuffer + offset + numBytesReadTotal, bytesToRead - numBytesReadTotal, NULL, &overlappedStruct)) == FALSE) && (GetLastError() != ERROR_IO_PENDING))
+		{
+			port->errorLineNumber = __LINE__ - 2;
+			port->errorNumber = GetLastError();
+			break;
+		}
+		else if (numBytesStripped && readTimeout && ((waitValue = WaitForSingleObject(overlappedStruct.hEvent, (DWORD)((remainingNanos + 999999LL) / 1000000LL))) == WAIT_TIMEOUT))
+		{
+			if (CancelIoEx)
+				CancelIoEx(port->handle, &overlappedStruct);
+			else
+				CancelIo(port->handle);
+		}
+		if (((result = GetOverlappedResult(port->handle, &overlappedStruct, &numBytesRead, TRUE)) == FALSE) && ((waitValue != WAIT_TIMEOUT) || (GetLastError() != ERROR_OPERATION_ABORTED)))
+		{
+			port->errorLineNumber = __LINE__ - 2;
+			port->errorNumber = GetLastError();
+			break;
+		}
+		result = TRUE;
+
+		// Strip the echo of any transmitted bytes, noting that any later reads only return data that arrived during this call
+		numBytesStripped = 0;
+		if ((numBytesRead > 0) && port->echoCancellation)
+		{
+			DWORD numBytesKept = (DWORD)cancelEcho(port, readBuffer + offset + numBytesReadTotal, (int)numBytesRead, echoArrivalObserved ? getMonotonicTimestamp() : 0, &collisionTimestamp);
+			numBytesStripped = numBytesRead - numBytesKept;
+			numBytesRead = numBytesKept;
+		}
+		echoArrivalObserved = TRUE;
+		numBytesReadTotal += numBytesRead;
+	} while (blocking && numBytesStripped && (numBytesReadTotal < (DWORD)bytesToRead) && (!readTimeout || ((remainingNanos = (deadline - getMonotonicTimestamp())) > 0)));
+	numBytesRead = numBytesReadTotal;
+	if (collisionTimestamp)
+	{
+		(*env)->SetLongField(env, obj, lastCollisionTimestampField, collisionTimestamp);
+		checkJniError(env, __LINE__ - 1);
 	}
-	else if ((result = GetOverlappedResult(port->handle, &overlappedStruct, &numBytesRead, TRUE)) == FALSE)
+
+	// Record the arrival time of the data, preferring the time at which the data was first detected as ready
+	if ((result == TRUE) && (numBytesRead > 0))
 	{
-		port->errorLineNumber = __LINE__ - 2;
-		port->errorNumber = GetLastError();
+		long long dataReadyTimestamp = port->dataReadyTimestamp;
+		port->lastReadTimestamp = dataReadyTimestamp ? dataReadyTimestamp : getMonotonicTimestamp();
+		port->dataReadyTimestamp = 0;
+		port->bytesRead += numBytesRead;
 	}
 
 	// Return number of bytes read
@@ -1317,6 +1537,218 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readBytes(JNIEnv
 	return (result == TRUE) ? numBytesRead : -1;
 }
 
+static int transferModbusBytes(serialPort *port, jbyte *buffer, int length, BOOL isWrite)
+{
+	// Create an asynchronous result structure
+	OVERLAPPED overlappedStruct;
+	memset(&overlappedStruct, 0, sizeof(OVERLAPPED));
+	overlappedStruct.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+	if (overlappedStruct.hEvent == NULL)
+	{
+		port->errorNumber = GetLastError();
+		port->errorLineNumber = __LINE__ - 4;
+		return -1;
+	}
+
+	// Transfer the requested number of bytes
+	BOOL result;
+	DWORD numBytesTransferred = 0;
+	if (isWrite)
+		++port->writeCalls;
+	else
+		++port->readCalls;
+	if (((result = (isWrite ? WriteFile(port->handle, buffer, length, NULL, &overlappedStruct) : ReadFile(port->handle, buffer, length, NULL, &overlappedStruct))) == FALSE) && (GetLastError() != ERROR_IO_PENDING))
+	{
+		port->errorLineNumber = __LINE__ - 2;
+		port->errorNumber = GetLastError();
+	}
+	else if ((result = GetOverlappedResult(port->handle, &overlappedStruct, &numBytesTransferred, TRUE)) == FALSE)
+	{
+		port->errorLineNumber = __LINE__ - 2;
+		port->errorNumber = GetLastError();
+	}
+	CloseHandle(overlappedStruct.hEvent);
+	if (result == TRUE)
+	{
+		if (isWrite)
+			port->bytesWritten += numBytesTransferred;
+		else
+			port->bytesRead += numBytesTransferred;
+	}
+	return (result == TRUE) ? (int)numBytesTransferred : -1;
+}
+
+// Precise wait function which sleeps for whole milliseconds and yields for any sub-millisecond remainder
+static void waitUntilTimestamp(long long timestamp)
+{
+	long long remainingNanos;
+	while ((remainingNanos = (timestamp - getMonotonicTimestamp())) > 0)
+		if (remainingNanos >= 2000000LL)
+			Sleep((DWORD)(remainingNanos / 1000000LL) - 1);
+		else
+			SwitchToThread();
+}
+
+// Comm event waiting functions
+static HANDLE createDeadlineTimer(long long remainingNanos)
+{
+	// Create a timer that expires after the specified time, with sub-millisecond precision wherever high-resolution timers are available
+	LARGE_INTEGER dueTime;
+	HANDLE timer = CreateWaitableTimerExW ? CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS) : NULL;
+	if (!timer)
+		timer = CreateWaitableTimerW(NULL, TRUE, NULL);
+	dueTime.QuadPart = -((remainingNanos + 99LL) / 100LL);
+	if (timer && !SetWaitableTimer(timer, &dueTime, 0, NULL, NULL, FALSE))
+	{
+		CloseHandle(timer);
+		timer = NULL;
+	}
+	return timer;
+}
+
+static int waitForCommEvents(serialPort *port, long long deadline, DWORD *eventMask)
+{
+	// Wait for any event in the current event mask, returning 1 if an event occurred, 0 if the deadline passed first, or -1 on error
+	long long remainingNanos = deadline - getMonotonicTimestamp();
+	*eventMask = 0;
+	if (remainingNanos <= 0)
+		return 0;
+
+	// Use a waitable timer to abort the wait at the deadline
+	OVERLAPPED overlappedStruct;
+	memset(&overlappedStruct, 0, sizeof(OVERLAPPED));
+	HANDLE timer = createDeadlineTimer(remainingNanos);
+	overlappedStruct.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+	HANDLE waitHandles[] = { overlappedStruct.hEvent, timer };
+	DWORD numBytesTransferred;
+	int result = -1;
+	if (!timer || !overlappedStruct.hEvent)
+	{
+		port->errorLineNumber = __LINE__ - 2;
+		port->errorNumber = GetLastError();
+	}
+	else if (WaitCommEvent(port->handle, eventMask, &overlappedStruct))
+		result = 1;
+	else if (GetLastError() == ERROR_INVALID_PARAMETER)
+	{
+		// Another thread is already waiting for events, so only wait briefly before the caller checks the port status again
+		WaitForSingleObject(timer, 1);
+		result = 1;
+	}
+	else if (GetLastError() == ERROR_IO_PENDING)
+	{
+		// Cancel the pending wait if the timer expires first, keeping any events that were reported before the cancellation took effect
+		if (WaitForMultipleObjects(2, waitHandles, FALSE, INFINITE) != WAIT_OBJECT_0)
+		{
+			if (CancelIoEx)
+				CancelIoEx(port->handle, &overlappedStruct);
+			else
+				CancelIo(port->handle);
+		}
+		if (GetOverlappedResult(port->handle, &overlappedStruct, &numBytesTransferred, TRUE))
+			result = 1;
+		else if (GetLastError() == ERROR_OPERATION_ABORTED)
+			result = 0;
+		else
+		{
+			port->errorLineNumber = __LINE__ - 6;
+			port->errorNumber = GetLastError();
+		}
+	}
+	else
+	{
+		port->errorLineNumber = __LINE__ - 30;
+		port->errorNumber = GetLastError();
+	}
+	if (timer)
+		CloseHandle(timer);
+	if (overlappedStruct.hEvent)
+		CloseHandle(overlappedStruct.hEvent);
+	return result;
+}
+
+static BOOL enableCommEvents(serialPort *port, DWORD events, DWORD *originalEventMask)
+{
+	// Make sure that WaitCommEvent() reports the specified events, retrieving the original event mask so that it can be restored afterward
+	if (!GetCommMask(port->handle, originalEventMask) || (((*originalEventMask & events) != events) && !SetCommMask(port->handle, *originalEventMask | events)))
+	{
+		port->errorLineNumber = __LINE__ - 2;
+		port->errorNumber = GetLastError();
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static void restoreCommEvents(serialPort *port, DWORD events, DWORD originalEventMask)
+{
+	// Only restore the original event mask if it had to be changed
+	if ((originalEventMask & events) != events)
+		SetCommMask(port->handle, originalEventMask);
+}
+
+static void waitForTransmitQueue(serialPort *port)
+{
+	// Wait for EV_TXEMPTY until the driver's transmit queue is empty, bounding each wait by the time needed to send the characters still queued
+	COMSTAT commInfo;
+	DWORD eventMask, originalEventMask;
+	if (!enableCommEvents(port, EV_TXEMPTY, &originalEventMask))
+		return;
+	while (ClearCommError(port->handle, NULL, &commInfo) && commInfo.cbOutQue)
+		if (waitForCommEvents(port, getMonotonicTimestamp() + ((commInfo.cbOutQue + 1) * port->characterTimeNanos) + 1000000LL, &eventMask) < 0)
+			break;
+	restoreCommEvents(port, EV_TXEMPTY, originalEventMask);
+}
+
+// Software RS-485 direction control functions
+static void recordRs485Timing(serialPort *port, int maximumIndex, int histogramIndex, long long durationNanos)
+{
+	// Histogram buckets are powers of two in microseconds, with the final bucket holding all longer durations
+	int bucket = 0;
+	long long durationMicros = durationNanos / 1000LL;
+	while ((durationMicros > 0) && (bucket < (RS485_HISTOGRAM_BUCKETS - 1)))
+	{
+		durationMicros >>= 1;
+		++bucket;
+	}
+	++port->rs485Statistics[histogramIndex + bucket];
+	if (durationNanos > port->rs485Statistics[maximumIndex])
+		port->rs485Statistics[maximumIndex] = durationNanos;
+}
+
+static int transmitRs485Frame(serialPort *port, jbyte *data, int length)
+{
+	// Enable the transmitter and wait for the configured delay before sending the first bit
+	EscapeCommFunction(port->handle, port->rs485ActiveHigh ? SETRTS : CLRRTS);
+	if (port->rs485DelayBefore > 0)
+		waitUntilTimestamp(getMonotonicTimestamp() + (port->rs485DelayBefore * 1000LL));
+
+	// Write the entire frame and wait for the driver's transmit queue to empty
+	long long writeTimestamp = getMonotonicTimestamp();
+	unsigned int echoHistoryHead = port->echoCancellation ? recordEchoHistory(port, data, length) : 0;
+	int numBytesWritten = transferModbusBytes(port, data, length, TRUE);
+	if (port->echoCancellation)
+		completeEchoHistory(port, echoHistoryHead, numBytesWritten);
+	if (numBytesWritten > 0)
+		waitForTransmitQueue(port);
+
+	// Windows does not expose the transmitter empty status, so wait until every written character has been clocked out at the configured baud rate
+	long long earliestEndTimestamp = writeTimestamp + (((numBytesWritten > 0) ? numBytesWritten : 0) * port->characterTimeNanos);
+	waitUntilTimestamp(earliestEndTimestamp);
+	long long endTimestamp = getMonotonicTimestamp();
+
+	// Release the bus after the configured delay
+	if (port->rs485DelayAfter > 0)
+		waitUntilTimestamp(endTimestamp + (port->rs485DelayAfter * 1000LL));
+	EscapeCommFunction(port->handle, port->rs485ActiveHigh ? CLRRTS : SETRTS);
+	port->lastBusActivityTimestamp = getMonotonicTimestamp();
+
+	// Record the end-of-transmission detection latency and the actual bus turnaround time
+	++port->rs485Statistics[0];
+	recordRs485Timing(port, 2, 4, port->lastBusActivityTimestamp - endTimestamp);
+	recordRs485Timing(port, 3, 4 + RS485_HISTOGRAM_BUCKETS, endTimestamp - earliestEndTimestamp);
+	return numBytesWritten;
+}
+
 JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeBytes(JNIEnv *env, jobject obj, jlong serialPortPointer, jbyteArray buffer, jint bytesToWrite, jint offset, jint timeoutMode)
 {
 	// Ensure that a positive number of bytes was passed in to write
@@ -1332,6 +1764,15 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeBytes(JNIEn
 	if (checkJniError(env, __LINE__ - 1) || !writeBuffer)
 		return -1;
 
+	// Let the transmitter control the bus direction in software RS-485 mode
+	if (port->rs485SoftwareControl)
+	{
+		int numBytesWritten = transmitRs485Frame(port, writeBuffer + offset, bytesToWrite);
+		(*env)->ReleaseByteArrayElements(env, buffer, writeBuffer, JNI_ABORT);
+		checkJniError(env, __LINE__ - 1);
+		return numBytesWritten;
+	}
+
 	// Create an asynchronous result structure
 	OVERLAPPED overlappedStruct;
 	memset(&overlappedStruct, 0, sizeof(OVERLAPPED));
@@ -1345,9 +1786,11 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeBytes(JNIEn
 		return -1;
 	}
 
-	// Write to the serial port
+	// Write to the serial port, remembering the transmitted bytes if their echo must be cancelled
 	BOOL result;
 	DWORD numBytesWritten = 0;
+	unsigned int echoHistoryHead = port->echoCancellation ? recordEchoHistory(port, writeBuffer + offset, bytesToWrite) : 0;
+	++port->writeCalls;
 	if (((result = WriteFile(port->handle, writeBuffer + offset, bytesToWrite, NULL, &overlappedStruct)) == FALSE) && (GetLastError() != ERROR_IO_PENDING))
 	{
 		port->errorLineNumber = __LINE__ - 2;
@@ -1358,8 +1801,12 @@ JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeBytes(JNIEn
 		port->errorLineNumber = __LINE__ - 2;
 		port->errorNumber = GetLastError();
 	}
+	if (port->echoCancellation)
+		completeEchoHistory(port, echoHistoryHead, (result == TRUE) ? (int)numBytesWritten : 0);
 
 	// Return number of bytes written
+	if (result == TRUE)
+		port->bytesWritten += numBytesWritten;
 	CloseHandle(overlappedStruct.hEvent);
 	(*env)->ReleaseByteArrayElements(env, buffer, writeBuffer, JNI_ABORT);
 	checkJniError(env, __LINE__ - 1);
@@ -1371,6 +1818,60 @@ JNIEXPORT void JNICALL Java_com_fazecast_jSerialComm_SerialPort_setEventListenin
 	((serialPort*)(intptr_t)serialPortPointer)->eventListenerRunning = eventListenerRunning;
 }
 
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_setModemLineCaptureStatus(JNIEnv *env, jobject obj, jlong serialPortPointer, jint lineMask)
+{
+	// Timestamped modem line edge capture is not supported on Windows
+	return lineMask ? JNI_FALSE : JNI_TRUE;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readModemLineEdges(JNIEnv *env, jobject obj, jlong serialPortPointer, jlongArray timestamps, jintArray lines, jintArray states)
+{
+	return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLostModemLineEdges(JNIEnv *env, jobject obj, jlong serialPortPointer)
+{
+	return 0;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readEchoCollisions(JNIEnv *env, jobject obj, jlong serialPortPointer, jlongArray timestamps, jbyteArray expected, jbyteArray received)
+{
+	// Determine how many collisions are waiting to be consumed
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	unsigned int tail = port->echoCollisionsTail;
+	int numCollisions = (int)(port->echoCollisionsHead - tail);
+	jsize maxCollisions = (*env)->GetArrayLength(env, timestamps);
+	if (checkJniError(env, __LINE__ - 1)) return -1;
+	if (numCollisions > maxCollisions)
+		numCollisions = maxCollisions;
+	MemoryBarrier();
+
+	// Copy the collisions out of the ring and release their slots
+	for (int i = 0; i < numCollisions; ++i)
+	{
+		echoCollision *collision = &port->echoCollisions[(tail + i) % ECHO_COLLISION_RING_SIZE];
+		jlong timestamp = collision->timestamp;
+		jbyte expectedByte = (jbyte)collision->expected, receivedByte = (jbyte)collision->received;
+		(*env)->SetLongArrayRegion(env, timestamps, i, 1, &timestamp);
+		(*env)->SetByteArrayRegion(env, expected, i, 1, &expectedByte);
+		(*env)->SetByteArrayRegion(env, received, i, 1, &receivedByte);
+		if (checkJniError(env, __LINE__ - 1)) return -1;
+	}
+	MemoryBarrier();
+	port->echoCollisionsTail = tail + numCollisions;
+	return numCollisions;
+}
+
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLostEchoCollisions(JNIEnv *env, jobject obj, jlong serialPortPointer)
+{
+	return ((serialPort*)(intptr_t)serialPortPointer)->echoCollisionsLost;
+}
+
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getCancelledEchoBytes(JNIEnv *env, jobject obj, jlong serialPortPointer)
+{
+	return ((serialPort*)(intptr_t)serialPortPointer)->echoBytesCancelled;
+}
+
 JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_setBreak(JNIEnv *env, jobject obj, jlong serialPortPointer)
 {
 	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
@@ -1514,6 +2015,767 @@ JNIEXPORT void JNICALL Java_com_fazecast_jSerialComm_SerialPort_quickConfig(JNIE
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLastReadTimestamp(JNIEnv *env, jobject obj, jlong serialPortPointer)
+{
+	return ((serialPort*)(intptr_t)serialPortPointer)->lastReadTimestamp;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLineStatistics(JNIEnv *env, jobject obj, jlong serialPortPointer, jlongArray statistics)
+{
+	// Return the userspace data transfer counters, since Windows does not maintain cumulative line counters
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	jlong counters[11] = { port->bytesRead, port->bytesWritten, port->readCalls, port->writeCalls, -1, -1, -1, -1, -1, -1, -1 };
+	(*env)->SetLongArrayRegion(env, statistics, 0, 11, counters);
+	checkJniError(env, __LINE__ - 1);
+	return JNI_FALSE;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_getRs485Statistics(JNIEnv *env, jobject obj, jlong serialPortPointer, jlongArray statistics)
+{
+	// Return the software RS-485 direction control timing statistics to the Java class
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	(*env)->SetLongArrayRegion(env, statistics, 0, sizeof(port->rs485Statistics) / sizeof(port->rs485Statistics[0]), (const jlong*)port->rs485Statistics);
+	if (checkJniError(env, __LINE__ - 1)) return JNI_FALSE;
+	return port->rs485SoftwareControl ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_fazecast_jSerialComm_SerialPort_waitForIdleGap(JNIEnv *env, jobject obj, jlong serialPortPointer, jlong idleGapNanos)
+{
+	// Wait until either new data arrives or the line has been silent for the requested amount of time since the most recently received data was read
+	COMSTAT commInfo;
+	DWORD eventMask;
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	long long deadline = port->lastReadTimestamp + idleGapNanos;
+	int waitResult = 1;
+	do
+	{
+		// Check the receive queue before each wait and once more after the deadline, since EV_RXCHAR may have been reported for data that was already read
+		if (!ClearCommError(port->handle, NULL, &commInfo))
+		{
+			port->errorLineNumber = __LINE__ - 2;
+			port->errorNumber = GetLastError();
+			return JNI_FALSE;
+		}
+		else if (commInfo.cbInQue)
+			return JNI_FALSE;
+		else if (!waitResult)
+			break;
+		else if ((waitResult = waitForCommEvents(port, deadline, &eventMask)) < 0)
+			return JNI_FALSE;
+
+		// Keep any other events for the event listener, which is not waiting for them while this function runs on its thread
+		port->pendingCommEvents |= (eventMask & ~EV_RXCHAR);
+	} while (port->eventListenerRunning);
+	return port->eventListenerRunning ? JNI_TRUE : JNI_FALSE;
+}
+
+static int waitForModbusData(serialPort *port, long long timeoutNanos)
+{
+	// Wait until either data is available or the line has been silent for the requested amount of time, relying on the caller to have enabled EV_RXCHAR
+	COMSTAT commInfo;
+	DWORD eventMask;
+	long long deadline = getMonotonicTimestamp() + timeoutNanos;
+	int waitResult = 1;
+	do
+	{
+		// Check the receive queue before each wait and once more after the deadline, since EV_RXCHAR may have been reported for data that was already read
+		if (!ClearCommError(port->handle, NULL, &commInfo))
+		{
+			port->errorLineNumber = __LINE__ - 2;
+			port->errorNumber = GetLastError();
+			return -1;
+		}
+		else if (commInfo.cbInQue)
+			return (int)commInfo.cbInQue;
+	} while (waitResult && ((waitResult = waitForCommEvents(port, deadline, &eventMask)) >= 0));
+	return waitResult;
+}
+
+static jint receiveModbusFrame(serialPort *port, jbyte *frame, jint frameCapacity, jint expectedLength, long long characterGapNanos, long long frameGapNanos, long long timeoutNanos)
+{
+	// Wait for the first byte of the frame to arrive
+	jbyte discardBuffer[256];
+	jboolean frameCorrupt = JNI_FALSE;
+	int bytesAvailable = waitForModbusData(port, timeoutNanos), numBytesRead;
+	jint frameLength = 0;
+	if (bytesAvailable <= 0)
+		return bytesAvailable;
+
+	// Read bytes until the line is silent for 1.5 character times or the expected response has been received
+	do
+	{
+		jbyte *readBuffer = (frameLength < frameCapacity) ? (frame + frameLength) : discardBuffer;
+		int bytesToRead = (frameLength < frameCapacity) ? (frameCapacity - frameLength) : (int)sizeof(discardBuffer);
+		if (bytesAvailable < bytesToRead)
+			bytesToRead = bytesAvailable;
+		if ((numBytesRead = transferModbusBytes(port, readBuffer, bytesToRead, FALSE)) < 0)
+			return -1;
+		port->lastReadTimestamp = port->lastBusActivityTimestamp = getMonotonicTimestamp();
+		if (readBuffer == discardBuffer)
+			frameCorrupt = JNI_TRUE;
+		else
+			frameLength += numBytesRead;
+
+		// Return as soon as a complete normal or exception response has been received
+		if ((expectedLength > 0) && !frameCorrupt && ((frameLength >= expectedLength) || ((frameLength >= 5) && (frame[1] & 0x80))))
+			return ((frameLength >= 5) && (frame[1] & 0x80)) ? 5 : expectedLength;
+	} while ((bytesAvailable = waitForModbusData(port, characterGapNanos)) > 0);
+	if (bytesAvailable < 0)
+		return -1;
+
+	// Any data arriving before 3.5 character times of silence have passed indicates a corrupt frame, so discard everything up to the next valid gap
+	while ((bytesAvailable = waitForModbusData(port, frameGapNanos - characterGapNanos)) > 0)
+	{
+		frameCorrupt = JNI_TRUE;
+		do
+		{
+			transferModbusBytes(port, discardBuffer, (bytesAvailable < (int)sizeof(discardBuffer)) ? bytesAvailable : (int)sizeof(discardBuffer), FALSE);
+			port->lastReadTimestamp = port->lastBusActivityTimestamp = getMonotonicTimestamp();
+		} while ((bytesAvailable = waitForModbusData(port, characterGapNanos)) > 0);
+		if (bytesAvailable < 0)
+			break;
+	}
+	return (bytesAvailable < 0) ? -1 : (frameCorrupt ? -2 : frameLength);
+}
+
+static int receiveModbusEcho(serialPort *port, long long *collisionTimestamp)
+{
+	// Consume the echo of a transmitted frame so that it cannot be mistaken for the start of the response
+	jbyte echoBuffer[256];
+	int bytesAvailable = 0, numBytesRead, numBytesPending;
+	long long remainingNanos;
+	while (((numBytesPending = (int)(port->echoHistoryHead - port->echoHistoryTail)) > 0) && ((remainingNanos = (port->echoDeadline - getMonotonicTimestamp())) > 0) && ((bytesAvailable = waitForModbusData(port, remainingNanos)) > 0))
+	{
+		if (numBytesPending > bytesAvailable)
+			numBytesPending = bytesAvailable;
+		if ((numBytesRead = transferModbusBytes(port, echoBuffer, (numBytesPending < (int)sizeof(echoBuffer)) ? numBytesPending : (int)sizeof(echoBuffer), FALSE)) < 0)
+			return -1;
+		port->lastReadTimestamp = port->lastBusActivityTimestamp = getMonotonicTimestamp();
+
+		// Any received bytes that do not belong to the echo indicate that another device was transmitting
+		if (cancelEcho(port, echoBuffer, numBytesRead, port->lastReadTimestamp, collisionTimestamp) > 0)
+			*collisionTimestamp = port->lastReadTimestamp;
+	}
+	discardEchoHistory(port);
+	return (bytesAvailable < 0) ? -1 : 0;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_writeModbusFrame(JNIEnv *env, jobject obj, jlong serialPortPointer, jbyteArray frame, jint length, jlong frameGapNanos)
+{
+	// Ensure that the bus has been idle for at least 3.5 character times since the last frame
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	long long remainingNanos = port->lastBusActivityTimestamp + frameGapNanos - getMonotonicTimestamp();
+	if ((length < 0) || (length > (*env)->GetArrayLength(env, frame)))
+		return -1;
+	if (remainingNanos > 0)
+	{
+		HANDLE timer = createDeadlineTimer(remainingNanos);
+		if (timer)
+		{
+			WaitForSingleObject(timer, INFINITE);
+			CloseHandle(timer);
+		}
+		else
+			Sleep((DWORD)((remainingNanos + 999999LL) / 1000000LL));
+	}
+
+	// Discard any stale received data, then write the complete frame
+	jbyte *writeBuffer = (*env)->GetByteArrayElements(env, frame, NULL);
+	if (checkJniError(env, __LINE__ - 1) || !writeBuffer)
+		return -1;
+	PurgeComm(port->handle, PURGE_RXCLEAR);
+	discardEchoHistory(port);
+	int numBytesWritten;
+	if (port->rs485SoftwareControl)
+		numBytesWritten = transmitRs485Frame(port, writeBuffer, length);
+	else
+	{
+		// Wait for the frame to leave the transmit queue so that the response timeout starts at the end of the request
+		unsigned int echoHistoryHead = port->echoCancellation ? recordEchoHistory(port, writeBuffer, length) : 0;
+		numBytesWritten = transferModbusBytes(port, writeBuffer, length, TRUE);
+		if (port->echoCancellation)
+			completeEchoHistory(port, echoHistoryHead, numBytesWritten);
+		if (numBytesWritten == length)
+			waitForTransmitQueue(port);
+		port->lastBusActivityTimestamp = getMonotonicTimestamp();
+	}
+	(*env)->ReleaseByteArrayElements(env, frame, writeBuffer, JNI_ABORT);
+	checkJniError(env, __LINE__ - 1);
+
+	// Remove the echo of the frame from the receive buffer, treating a collision as a failed transmission
+	DWORD originalEventMask;
+	long long collisionTimestamp = 0;
+	if ((numBytesWritten == length) && port->echoCancellation)
+	{
+		if (!enableCommEvents(port, EV_RXCHAR, &originalEventMask))
+			numBytesWritten = -1;
+		else
+		{
+			if (receiveModbusEcho(port, &collisionTimestamp))
+				numBytesWritten = -1;
+			restoreCommEvents(port, EV_RXCHAR, originalEventMask);
+		}
+	}
+	if (collisionTimestamp)
+	{
+		numBytesWritten = -1;
+		(*env)->SetLongField(env, obj, lastCollisionTimestampField, collisionTimestamp);
+		checkJniError(env, __LINE__ - 1);
+	}
+	return (numBytesWritten == length) ? numBytesWritten : -1;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_readModbusFrame(JNIEnv *env, jobject obj, jlong serialPortPointer, jbyteArray buffer, jint expectedLength, jlong characterGapNanos, jlong frameGapNanos, jint timeout)
+{
+	// Receive a single frame directly into the Java buffer, waiting for received characters to be reported by the driver
+	DWORD originalEventMask;
+	serialPort *port = (serialPort*)(intptr_t)serialPortPointer;
+	jbyte *frame = (*env)->GetByteArrayElements(env, buffer, NULL);
+	if (checkJniError(env, __LINE__ - 1) || !frame)
+		return -1;
+	jint frameLength = -1;
+	if (enableCommEvents(port, EV_RXCHAR, &originalEventMask))
+	{
+		frameLength = receiveModbusFrame(port, frame, (*env)->GetArrayLength(env, buffer), expectedLength, characterGapNanos, frameGapNanos, (long long)timeout * 1000000LL);
+		restoreCommEvents(port, EV_RXCHAR, originalEventMask);
+	}
+	(*env)->ReleaseByteArrayElements(env, buffer, frame, (frameLength > 0) ? 0 : JNI_ABORT);
+	checkJniError(env, __LINE__ - 1);
+	return frameLength;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findDelimiters(JNIEnv *env, jclass serialCommClass, jbyteArray buffer, jint startIndex, jint endIndex, jbyteArray delimiter, jintArray delimiterOffsets)
+{
+	// Retrieve direct access to the Java arrays without copying them
+	jint numDelimiters = 0;
+	jsize delimiterLength = (*env)->GetArrayLength(env, delimiter), maxDelimiters = (*env)->GetArrayLength(env, delimiterOffsets);
+	if ((delimiterLength == 0) || (maxDelimiters == 0) || ((endIndex - startIndex) < delimiterLength))
+		return 0;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	if (!data) return 0;
+	jbyte *pattern = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, delimiter, NULL);
+	jint *offsets = (jint*)(*env)->GetPrimitiveArrayCritical(env, delimiterOffsets, NULL);
+
+	// Use the vectorized C library memchr() to locate each candidate first byte, then verify the remainder of the delimiter
+	if (pattern && offsets)
+	{
+		const jbyte *search = data + startIndex, *lastStart = data + endIndex - delimiterLength;
+		while ((numDelimiters < maxDelimiters) && (search <= lastStart) && ((search = (const jbyte*)memchr(search, pattern[0], 1 + lastStart - search)) != NULL))
+			if ((delimiterLength == 1) || !memcmp(search + 1, pattern + 1, delimiterLength - 1))
+			{
+				offsets[numDelimiters++] = (jint)(search - data);
+				search += delimiterLength;
+			}
+			else
+				++search;
+	}
+
+	// Release the Java arrays, only copying back the delimiter offsets
+	if (offsets) (*env)->ReleasePrimitiveArrayCritical(env, delimiterOffsets, offsets, 0);
+	if (pattern) (*env)->ReleasePrimitiveArrayCritical(env, delimiter, pattern, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, buffer, data, JNI_ABORT);
+	return numDelimiters;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeSlip(JNIEnv *env, jclass serialCommClass, jbyteArray data, jint offset, jint length, jbyteArray encodedData)
+{
+	// Ensure that the output buffer can hold the worst-case encoding, including the leading and trailing END bytes
+	if (((*env)->GetArrayLength(env, encodedData) < ((2 * length) + 2)) || ((*env)->GetArrayLength(env, data) < (offset + length)))
+		return -1;
+	jbyte *input = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, data, NULL);
+	if (!input) return -1;
+	jbyte *output = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, encodedData, NULL);
+	if (!output)
+	{
+		(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+		return -1;
+	}
+
+	// Escape all END (0xC0) and ESC (0xDB) bytes, surrounding the frame with END bytes to flush any preceding line noise
+	const jbyte *in = input + offset, *end = input + offset + length;
+	jbyte *out = output;
+	*out++ = (jbyte)0xC0;
+	for (; in < end; ++in)
+		if (*in == (jbyte)0xC0)
+		{
+			*out++ = (jbyte)0xDB;
+			*out++ = (jbyte)0xDC;
+		}
+		else if (*in == (jbyte)0xDB)
+		{
+			*out++ = (jbyte)0xDB;
+			*out++ = (jbyte)0xDD;
+		}
+		else
+			*out++ = *in;
+	*out++ = (jbyte)0xC0;
+
+	// Release the Java arrays, only copying back the encoded data
+	jint encodedLength = (jint)(out - output);
+	(*env)->ReleasePrimitiveArrayCritical(env, encodedData, output, 0);
+	(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+	return encodedLength;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeSlip(JNIEnv *env, jclass serialCommClass, jbyteArray buffer, jint offset, jint length)
+{
+	// Retrieve direct access to the Java array without copying it
+	if ((*env)->GetArrayLength(env, buffer) < (offset + length))
+		return -1;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	if (!data) return -1;
+
+	// Decode the frame in place, using memchr() to locate each ESC (0xDB) byte and moving the intervening data as a single block
+	const jbyte *in = data + offset, *end = data + offset + length;
+	jbyte *out = data + offset;
+	while (in < end)
+	{
+		const jbyte *escape = (const jbyte*)memchr(in, 0xDB, end - in);
+		jint runLength = escape ? (jint)(escape - in) : (jint)(end - in);
+		memmove(out, in, runLength);
+		out += runLength;
+		if (!escape)
+			break;
+		else if (((end - escape) < 2) || ((escape[1] != (jbyte)0xDC) && (escape[1] != (jbyte)0xDD)))
+		{
+			out = NULL;
+			break;
+		}
+		*out++ = (escape[1] == (jbyte)0xDC) ? (jbyte)0xC0 : (jbyte)0xDB;
+		in = escape + 2;
+	}
+
+	// Release the Java array, only copying back the data if it was successfully decoded
+	jint decodedLength = out ? (jint)(out - (data + offset)) : -1;
+	(*env)->ReleasePrimitiveArrayCritical(env, buffer, data, out ? 0 : JNI_ABORT);
+	return decodedLength;
+}
+
+// Reflected FCS-16 (0x8408) and FCS-32 (0xEDB88320) lookup tables defined by RFC 1662
+static const unsigned int hdlcFcs16Table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+	0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+	0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+	0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+	0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+	0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+	0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+	0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+	0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+	0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+	0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+	0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+	0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+	0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+	0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+	0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+	0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+	0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+	0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+	0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+	0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+	0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+	0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+	0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+	0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+	0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+	0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+	0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+	0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+	0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+	0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+	0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+};
+static const unsigned int hdlcFcs32Table[256] = {
+	0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+	0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+	0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+	0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+	0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+	0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+	0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+	0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+	0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+	0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+	0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+	0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+	0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+	0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+	0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+	0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+	0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+	0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+	0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+	0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+	0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+	0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+	0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+	0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+	0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+	0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+	0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+	0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+	0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+	0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+	0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+	0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+static inline unsigned int updateHdlcFcs(unsigned int fcs, unsigned char value, int fcsBits)
+{
+	return (fcsBits == 32) ? ((fcs >> 8) ^ hdlcFcs32Table[(fcs ^ value) & 0xFF]) : ((fcs >> 8) ^ hdlcFcs16Table[(fcs ^ value) & 0xFF]);
+}
+
+static inline jbyte* escapeHdlcByte(jbyte *out, unsigned char value, unsigned int accm)
+{
+	// Escape flag and control-escape bytes, as well as any control characters selected by the async control character map
+	if ((value == 0x7E) || (value == 0x7D) || ((value < 0x20) && (accm & (1U << value))))
+	{
+		*out++ = (jbyte)0x7D;
+		*out++ = (jbyte)(value ^ 0x20);
+	}
+	else
+		*out++ = (jbyte)value;
+	return out;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeHdlc(JNIEnv *env, jclass serialCommClass, jbyteArray data, jint offset, jint length, jint accm, jint fcsBits, jbyteArray encodedData)
+{
+	// Ensure that the output buffer can hold the worst-case encoding, including the FCS and both flag bytes
+	jint fcsLength = (fcsBits == 32) ? 4 : ((fcsBits == 16) ? 2 : 0);
+	if (((*env)->GetArrayLength(env, encodedData) < ((2 * (length + fcsLength)) + 2)) || ((*env)->GetArrayLength(env, data) < (offset + length)))
+		return -1;
+	jbyte *input = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, data, NULL);
+	if (!input) return -1;
+	jbyte *output = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, encodedData, NULL);
+	if (!output)
+	{
+		(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+		return -1;
+	}
+
+	// Escape the payload while calculating its FCS, then append the complemented FCS in little-endian order
+	unsigned int fcsInit = (fcsBits == 32) ? 0xFFFFFFFF : 0xFFFF, fcs = fcsInit;
+	jbyte *out = output;
+	*out++ = (jbyte)0x7E;
+	for (jint i = 0; i < length; ++i)
+	{
+		unsigned char value = (unsigned char)input[offset + i];
+		if (fcsLength)
+			fcs = updateHdlcFcs(fcs, value, fcsBits);
+		out = escapeHdlcByte(out, value, (unsigned int)accm);
+	}
+	fcs ^= fcsInit;
+	for (jint i = 0; i < fcsLength; ++i)
+		out = escapeHdlcByte(out, (unsigned char)(fcs >> (8 * i)), (unsigned int)accm);
+	*out++ = (jbyte)0x7E;
+
+	// Release the Java arrays, only copying back the encoded data
+	jint encodedLength = (jint)(out - output);
+	(*env)->ReleasePrimitiveArrayCritical(env, encodedData, output, 0);
+	(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+	return encodedLength;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(JNIEnv *env, jclass serialCommClass, jbyteArray buffer, jint offset, jint length, jint accm, jint fcsBits)
+{
+	// Retrieve direct access to the Java array without copying it
+	if ((*env)->GetArrayLength(env, buffer) < (offset + length))
+		return -1;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	if (!data) return -1;
+
+	// Decode the frame in place while calculating its FCS, discarding any control characters selected by the async control character map
+	jint fcsLength = (fcsBits == 32) ? 4 : ((fcsBits == 16) ? 2 : 0), decodedLength, isEscaped = 0;
+	unsigned int fcs = (fcsBits == 32) ? 0xFFFFFFFF : 0xFFFF;
+	const jbyte *in = data + offset, *end = data + offset + length;
+	jbyte *out = data + offset;
+	for (; in < end; ++in)
+	{
+		unsigned char value = (unsigned char)*in;
+		if ((value < 0x20) && ((unsigned int)accm & (1U << value)))
+			continue;
+		else if ((value == 0x7D) && !isEscaped)
+		{
+			isEscaped = 1;
+			continue;
+		}
+		else if (isEscaped)
+		{
+			value ^= 0x20;
+			isEscaped = 0;
+		}
+		if (fcsLength)
+			fcs = updateHdlcFcs(fcs, value, fcsBits);
+		*out++ = (jbyte)value;
+	}
+
+	// Verify the FCS residue: -1 indicates an aborted or improperly escaped frame, and -2 indicates an FCS mismatch
+	decodedLength = (jint)(out - (data + offset));
+	if (isEscaped)
+		decodedLength = -1;
+	else if ((decodedLength < fcsLength) || (fcsLength && (fcs != ((fcsBits == 32) ? 0xDEBB20E3 : 0xF0B8))))
+		decodedLength = -2;
+	else
+		decodedLength -= fcsLength;
+
+	// Release the Java array, only copying back the data if it was successfully decoded
+	(*env)->ReleasePrimitiveArrayCritical(env, buffer, data, (decodedLength >= 0) ? 0 : JNI_ABORT);
+	return decodedLength;
+}
+
+static unsigned int updateCrcSliceBy8(const jint *tables, jboolean reflected, unsigned int crc, const unsigned char *data, jint length)
+{
+	// Process eight bytes at a time using the slice-by-8 tables, where table k advances the CRC by k additional zero bytes
+	const unsigned int *t = (const unsigned int*)tables;
+	if (reflected)
+	{
+		for (; length >= 8; data += 8, length -= 8)
+		{
+			unsigned int one = crc ^ ((unsigned int)data[0] | ((unsigned int)data[1] << 8) | ((unsigned int)data[2] << 16) | ((unsigned int)data[3] << 24));
+			unsigned int two = (unsigned int)data[4] | ((unsigned int)data[5] << 8) | ((unsigned int)data[6] << 16) | ((unsigned int)data[7] << 24);
+			crc = t[1792 + (one & 0xFF)] ^ t[1536 + ((one >> 8) & 0xFF)] ^ t[1280 + ((one >> 16) & 0xFF)] ^ t[1024 + (one >> 24)] ^
+					t[768 + (two & 0xFF)] ^ t[512 + ((two >> 8) & 0xFF)] ^ t[256 + ((two >> 16) & 0xFF)] ^ t[two >> 24];
+		}
+		for (; length > 0; ++data, --length)
+			crc = t[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+	}
+	else
+	{
+		for (; length >= 8; data += 8, length -= 8)
+		{
+			unsigned int one = crc ^ (((unsigned int)data[0] << 24) | ((unsigned int)data[1] << 16) | ((unsigned int)data[2] << 8) | (unsigned int)data[3]);
+			unsigned int two = ((unsigned int)data[4] << 24) | ((unsigned int)data[5] << 16) | ((unsigned int)data[6] << 8) | (unsigned int)data[7];
+			crc = t[1792 + (one >> 24)] ^ t[1536 + ((one >> 16) & 0xFF)] ^ t[1280 + ((one >> 8) & 0xFF)] ^ t[1024 + (one & 0xFF)] ^
+					t[768 + (two >> 24)] ^ t[512 + ((two >> 16) & 0xFF)] ^ t[256 + ((two >> 8) & 0xFF)] ^ t[two & 0xFF];
+		}
+		for (; length > 0; ++data, --length)
+			crc = t[((crc >> 24) ^ *data) & 0xFF] ^ (crc << 8);
+	}
+	return crc;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_updateCrc(JNIEnv *env, jclass serialCommClass, jintArray crcTables, jboolean reflected, jint crc, jbyteArray data, jint offset, jint length)
+{
+	// Retrieve direct access to the Java arrays without copying them
+	if (((*env)->GetArrayLength(env, crcTables) < 2048) || (offset < 0) || (length < 0) || (length > ((*env)->GetArrayLength(env, data) - offset)))
+		return crc;
+	jint *tables = (jint*)(*env)->GetPrimitiveArrayCritical(env, crcTables, NULL);
+	if (!tables) return crc;
+	jbyte *input = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, data, NULL);
+	if (input)
+	{
+		crc = (jint)updateCrcSliceBy8(tables, reflected, (unsigned int)crc, (const unsigned char*)input + offset, length);
+		(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, crcTables, tables, JNI_ABORT);
+	return crc;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_updateCrcDirect(JNIEnv *env, jclass serialCommClass, jintArray crcTables, jboolean reflected, jint crc, jobject data, jint offset, jint length)
+{
+	// Calculate the CRC directly from the memory backing a direct ByteBuffer
+	const unsigned char *input = (const unsigned char*)(*env)->GetDirectBufferAddress(env, data);
+	if (!input || (offset < 0) || (length < 0) || ((*env)->GetDirectBufferCapacity(env, data) < ((jlong)offset + length)) || ((*env)->GetArrayLength(env, crcTables) < 2048))
+		return crc;
+	jint *tables = (jint*)(*env)->GetPrimitiveArrayCritical(env, crcTables, NULL);
+	if (!tables) return crc;
+	crc = (jint)updateCrcSliceBy8(tables, reflected, (unsigned int)crc, input + offset, length);
+	(*env)->ReleasePrimitiveArrayCritical(env, crcTables, tables, JNI_ABORT);
+	return crc;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findPatterns(JNIEnv *env, jclass serialCommClass, jintArray automaton, jbyteArray buffer, jint startIndex, jint endIndex, jint maxMatchesPerByte, jintArray matcherState, jintArray matches)
+{
+	// Retrieve direct access to the Java arrays without copying them
+	jint numMatches = 0, index = startIndex;
+	jsize numStates = (*env)->GetArrayLength(env, automaton) / 258, maxMatches = (*env)->GetArrayLength(env, matches) / 2;
+	if ((numStates == 0) || ((*env)->GetArrayLength(env, matcherState) < 2))
+		return 0;
+	jint *transitions = (jint*)(*env)->GetPrimitiveArrayCritical(env, automaton, NULL);
+	if (!transitions) return 0;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	jint *state = (jint*)(*env)->GetPrimitiveArrayCritical(env, matcherState, NULL);
+	jint *results = (jint*)(*env)->GetPrimitiveArrayCritical(env, matches, NULL);
+
+	// Advance the automaton one byte at a time, stopping early if the next byte could overflow the match array
+	if (data && state && results)
+	{
+		const jint *patternIds = transitions + (numStates * 256), *outputLinks = patternIds + numStates;
+		jint currentState = ((state[0] >= 0) && (state[0] < numStates)) ? state[0] : 0;
+		for (; (index < endIndex) && ((maxMatches - numMatches) >= maxMatchesPerByte); ++index)
+		{
+			currentState = transitions[(currentState << 8) | (unsigned char)data[index]];
+			for (jint output = (patternIds[currentState] >= 0) ? currentState : outputLinks[currentState]; output > 0; output = outputLinks[output])
+			{
+				results[2 * numMatches] = patternIds[output];
+				results[(2 * numMatches++) + 1] = index + 1;
+			}
+		}
+		state[0] = currentState;
+		state[1] = index;
+	}
+
+	// Release the Java arrays, only copying back the automaton state and any matches
+	if (results) (*env)->ReleasePrimitiveArrayCritical(env, matches, results, 0);
+	if (state) (*env)->ReleasePrimitiveArrayCritical(env, matcherState, state, 0);
+	if (data) (*env)->ReleasePrimitiveArrayCritical(env, buffer, data, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, automaton, transitions, JNI_ABORT);
+	return numMatches;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_findLengthFieldFrames(JNIEnv *env, jclass serialCommClass, jbyteArray buffer, jint startIndex, jint endIndex, jbyteArray syncWord, jintArray frameFormat, jintArray framerState, jintArray frames)
+{
+	// Retrieve direct access to the Java arrays without copying them
+	jint numFrames = 0, index = startIndex, discardedBytes = 0, syncLosses = 0;
+	jsize syncLength = (*env)->GetArrayLength(env, syncWord), maxFrames = (*env)->GetArrayLength(env, frames) / 2;
+	if (((*env)->GetArrayLength(env, frameFormat) < 5) || ((*env)->GetArrayLength(env, framerState) < 4))
+		return 0;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	if (!data) return 0;
+	jbyte *sync = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, syncWord, NULL);
+	jint *format = (jint*)(*env)->GetPrimitiveArrayCritical(env, frameFormat, NULL);
+	jint *state = (jint*)(*env)->GetPrimitiveArrayCritical(env, framerState, NULL);
+	jint *results = (jint*)(*env)->GetPrimitiveArrayCritical(env, frames, NULL);
+
+	if (sync && format && state && results)
+	{
+		// Determine the frame header layout: [lengthFieldOffset, lengthFieldSize, isBigEndian, lengthAdjustment, maximumFrameSize]
+		jint lengthOffset = format[0], lengthSize = format[1], isBigEndian = format[2], lengthAdjustment = format[3], maxFrameSize = format[4];
+		jint headerLength = ((lengthOffset + lengthSize) > syncLength) ? (lengthOffset + lengthSize) : syncLength;
+		int syncLost = state[2];
+
+		// Parse as many complete frames as possible, discarding data until the next plausible frame header whenever a frame is corrupt
+		while ((numFrames < maxFrames) && ((endIndex - index) >= ((syncLength > 0) ? syncLength : headerLength)))
+		{
+			int isValid = !syncLength || !memcmp(data + index, sync, syncLength);
+			long long frameLength = 0;
+			if (isValid && ((endIndex - index) < headerLength))
+				break;
+			else if (isValid)
+			{
+				unsigned long long lengthValue = 0;
+				for (jint i = 0; i < lengthSize; ++i)
+					lengthValue |= (unsigned long long)(unsigned char)data[index + lengthOffset + (isBigEndian ? i : (lengthSize - 1 - i))] << (8 * (lengthSize - 1 - i));
+				frameLength = (long long)(lengthOffset + lengthSize) + (long long)lengthValue + lengthAdjustment;
+				isValid = (frameLength >= headerLength) && (frameLength <= maxFrameSize);
+			}
+			if (!isValid)
+			{
+				// Skip ahead to the next synchronization word, keeping any partial synchronization word at the end of the buffer
+				const jbyte *search = data + index + 1, *lastStart = data + endIndex - syncLength;
+				jint nextIndex = index + 1;
+				if (syncLength)
+				{
+					while ((search <= lastStart) && ((search = (const jbyte*)memchr(search, sync[0], 1 + lastStart - search)) != NULL) && memcmp(search + 1, sync + 1, syncLength - 1))
+						++search;
+					nextIndex = (search && (search <= lastStart)) ? (jint)(search - data) : (((endIndex + 1 - syncLength) > nextIndex) ? (endIndex + 1 - syncLength) : nextIndex);
+				}
+				if (!syncLost)
+					++syncLosses;
+				syncLost = 1;
+				discardedBytes += nextIndex - index;
+				index = nextIndex;
+			}
+			else if ((endIndex - index) < frameLength)
+				break;
+			else
+			{
+				results[2 * numFrames] = index;
+				results[(2 * numFrames++) + 1] = (jint)frameLength;
+				index += (jint)frameLength;
+				syncLost = 0;
+			}
+		}
+
+		// Return the updated framer state: [nextStartIndex, discardedBytes, isSyncLost, numSyncLosses]
+		state[0] = index;
+		state[1] = discardedBytes;
+		state[2] = syncLost;
+		state[3] = syncLosses;
+	}
+
+	// Release the Java arrays, only copying back the framer state and frame boundaries
+	if (results) (*env)->ReleasePrimitiveArrayCritical(env, frames, results, 0);
+	if (state) (*env)->ReleasePrimitiveArrayCritical(env, framerState, state, 0);
+	if (format) (*env)->ReleasePrimitiveArrayCritical(env, frameFormat, format, JNI_ABORT);
+	if (sync) (*env)->ReleasePrimitiveArrayCritical(env, syncWord, sync, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, buffer, data, JNI_ABORT);
+	return numFrames;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_encodeCobs(JNIEnv *env, jclass serialCommClass, jbyteArray data, jint offset, jint length, jbyteArray encodedData)
+{
+	// Ensure that the output buffer can hold the worst-case encoding, including the trailing frame delimiter
+	if (((*env)->GetArrayLength(env, encodedData) < (length + (length / 254) + 2)) || ((*env)->GetArrayLength(env, data) < (offset + length)))
+		return -1;
+	jbyte *input = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, data, NULL);
+	if (!input) return -1;
+	jbyte *output = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, encodedData, NULL);
+	if (!output)
+	{
+		(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+		return -1;
+	}
+
+	// Use the vectorized C library memchr() to locate each zero byte, copying the intervening data as a single block
+	const jbyte *in = input + offset, *end = input + offset + length;
+	jbyte *out = output;
+	while (1)
+	{
+		jint window = ((end - in) < 254) ? (jint)(end - in) : 254;
+		const jbyte *zero = (const jbyte*)memchr(in, 0, window);
+		jint blockLength = zero ? (jint)(zero - in) : window;
+		*out++ = (jbyte)(blockLength + 1);
+		memcpy(out, in, blockLength);
+		out += blockLength;
+		in += blockLength;
+		if (zero)
+			++in;
+		else if ((blockLength < 254) || (in == end))
+			break;
+	}
+	*out++ = 0;
+
+	// Release the Java arrays, only copying back the encoded data
+	jint encodedLength = (jint)(out - output);
+	(*env)->ReleasePrimitiveArrayCritical(env, encodedData, output, 0);
+	(*env)->ReleasePrimitiveArrayCritical(env, data, input, JNI_ABORT);
+	return encodedLength;
+}
+
+JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_decodeCobs(JNIEnv *env, jclass serialCommClass, jbyteArray buffer, jint offset, jint length)
+{
+	// Retrieve direct access to the Java array without copying it
+	if ((*env)->GetArrayLength(env, buffer) < (offset + length))
+		return -1;
+	jbyte *data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, buffer, NULL);
+	if (!data) return -1;
+
+	// Decode the frame in place, since decoded data is never longer than its encoding
+	const jbyte *in = data + offset, *end = data + offset + length;
+	jbyte *out = data + offset;
+	while (in < end)
+	{
+		jint code = (unsigned char)*in++;
+		if (!code || ((end - in) < (code - 1)))
+		{
+			out = NULL;
+			break;
+		}
+		memmove(out, in, code - 1);
+		out += code - 1;
+		in += code - 1;
+		if ((code != 0xFF) && (in < end))
+			*out++ = 0;
+	}
+
+	// Release the Java array, only copying back the data if it was successfully decoded
+	jint decodedLength = out ? (jint)(out - (data + offset)) : -1;
+	(*env)->ReleasePrimitiveArrayCritical(env, buffer, data, out ? 0 : JNI_ABORT);
+	return decodedLength;
+}
+
 JNIEXPORT jint JNICALL Java_com_fazecast_jSerialComm_SerialPort_getLastErrorLocation(JNIEnv *env, jobject obj, jlong serialPortPointer)
 {
 	return serialPortPointer ? ((serialPort*)(intptr_t)serialPortPointer)->errorLineNumber : lastErrorLineNumber;
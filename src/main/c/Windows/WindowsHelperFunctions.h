@@ -2,10 +2,10 @@
  * WindowsHelperFunctions.h
  *
  *       Created on:  May 05, 2015
- *  Last Updated on:  Nov 02, 2025
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2025 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -29,13 +29,33 @@
 // Serial port JNI header file
 #include "../com_fazecast_jSerialComm_SerialPort.h"
 
+// Half-duplex echo collision structure
+#define ECHO_HISTORY_SIZE 4096
+#define ECHO_COLLISION_RING_SIZE 64
+typedef struct echoCollision
+{
+	long long timestamp;
+	unsigned char expected, received;
+} echoCollision;
+
 // Serial port data structure
+#define RS485_HISTOGRAM_BUCKETS 20
 typedef struct serialPort
 {
 	void *handle;
 	wchar_t *portPath, *friendlyName, *portDescription, *portLocation;
 	wchar_t *serialNumber, *manufacturer, *deviceDriver;
 	int errorLineNumber, errorNumber, vendorID, productID;
+	volatile long long dataReadyTimestamp, lastReadTimestamp, lastBusActivityTimestamp;
+	volatile long long bytesRead, bytesWritten, readCalls, writeCalls;
+	long long characterTimeNanos, rs485Statistics[4 + (2 * RS485_HISTOGRAM_BUCKETS)];
+	echoCollision echoCollisions[ECHO_COLLISION_RING_SIZE];
+	unsigned char echoHistory[ECHO_HISTORY_SIZE];
+	volatile unsigned int echoHistoryHead, echoHistoryTail, echoCollisionsHead, echoCollisionsTail;
+	volatile long long echoDeadline, echoTimeoutNanos, echoBytesCancelled, echoCollisionsLost;
+	int rs485DelayBefore, rs485DelayAfter;
+	unsigned long pendingCommEvents;
+	char rs485SoftwareControl, rs485ActiveHigh, echoCancellation;
 	volatile char enumerated, eventListenerRunning;
 	char ftdiSerialNumber[16];
 } serialPort;
@@ -2,10 +2,10 @@
  * SerialPort.java
  *
  *       Created on:  Feb 25, 2012
- *  Last Updated on:  Nov 02, 2025
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2025 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -29,7 +29,6 @@ import com.fazecast.jSerialComm.android.AndroidPort;
 
 import java.lang.ProcessBuilder;
 import java.io.BufferedReader;
-import java.io.ByteArrayOutputStream;
 import java.io.DataOutputStream;
 import java.io.File;
 import java.io.FileOutputStream;
@@ -38,11 +37,17 @@ import java.io.IOException;
 import java.io.InputStream;
 import java.io.InputStreamReader;
 import java.io.OutputStream;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
+import java.util.ArrayDeque;
 import java.util.Arrays;
 import java.util.Date;
+import java.util.Iterator;
 import java.util.List;
 import java.util.Vector;
+import java.util.concurrent.Executor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.Condition;
 import java.util.concurrent.locks.ReentrantLock;
 
 /**
@@ -96,8 +101,21 @@ public class SerialPort
 	static final public int LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR = 0x00400000;
 	static final public int LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR = 0x00800000;
 	static final public int LISTENING_EVENT_PARITY_ERROR = 0x01000000;
+	static final public int LISTENING_EVENT_COLLISION = 0x02000000;
 	static final public int LISTENING_EVENT_PORT_DISCONNECTED = 0x10000000;
 
+	// Latency Profiles
+	static final public int LATENCY_PROFILE_DEFAULT = 0;
+	static final public int LATENCY_PROFILE_LOW_LATENCY = 1;
+	static final public int LATENCY_PROFILE_BALANCED = 2;
+	static final public int LATENCY_PROFILE_THROUGHPUT = 3;
+
+	// Receive Queue Overflow Policies
+	static final public int RECEIVE_QUEUE_BLOCK = 0;
+	static final public int RECEIVE_QUEUE_DROP_OLDEST = 1;
+	static final public int RECEIVE_QUEUE_DROP_NEWEST = 2;
+	static final public int RECEIVE_QUEUE_COALESCE = 3;
+
 	// Static initializer loads correct native library for this machine
 	static private final ReentrantLock libraryLock = new ReentrantLock(true);
 	static private final String versionString = "2.12.0";
@@ -563,16 +581,22 @@ public class SerialPort
 	private volatile int baudRate = 9600, dataBits = 8, stopBits = SerialPort.ONE_STOP_BIT, parity = SerialPort.NO_PARITY, eventFlags = 0;
 	private volatile int timeoutMode = SerialPort.TIMEOUT_NONBLOCKING, readTimeout = 0, writeTimeout = 0, flowControl = 0;
 	private volatile int sendDeviceQueueSize = 4096, receiveDeviceQueueSize = 4096, vendorID, productID;
-	private volatile int safetySleepTimeMS = 200, rs485DelayBefore = 0, rs485DelayAfter = 0;
+	private volatile int safetySleepTimeMS = 200, rs485DelayBefore = 0, rs485DelayAfter = 0, echoTimeout = 100;
+	private volatile int latencyProfile = SerialPort.LATENCY_PROFILE_DEFAULT, latencyTimer = -1;
+	private volatile int receiveQueuePolicy = SerialPort.RECEIVE_QUEUE_BLOCK, receiveQueueCapacity = 0, maximumMessageSize = 0, receiveQueueHighWaterMark = 0;
+	private volatile long receiveQueueDroppedEvents = 0, receiveQueueDroppedBytes = 0, receiveQueueCoalescedEvents = 0, discardedMessageCount = 0;
+	private volatile long packetSyncLossCount = 0, packetSyncDiscardedBytes = 0, framingErrorCount = 0, malformedEscapeCount = 0, checksumErrorCount = 0;
+	private volatile long lastCollisionTimestamp = 0;
 	private volatile byte xonStartChar = 17, xoffStopChar = 19;
-	private volatile SerialPortDataListener userDataListener = null;
 	private volatile SerialPortEventListener serialEventListener = null;
+	private volatile SerialPortBufferPool eventBufferPool = null;
 	private volatile String comPort, friendlyName, portDescription, portLocation, serialNumber, manufacturer, deviceDriver;
 	private volatile boolean eventListenerRunning = false, disableConfig = false, disableExclusiveLock = false;
 	private volatile boolean rs485Mode = false, rs485ActiveHigh = true, rs485RxDuringTx = false, rs485EnableTermination = false;
 	private volatile boolean isRtsEnabled = true, isDtrEnabled = true, autoFlushIOBuffers = false, requestElevatedPermissions = false;
-	private volatile boolean rs485ModeControlEnabled = true, isPathSymlink = false;
-	private final ReentrantLock configurationLock = new ReentrantLock(true);
+	private volatile boolean rs485ModeControlEnabled = true, rs485SoftwareControl = false, isPathSymlink = false, isLowLatencyEnabled = false;
+	private volatile boolean echoCancellation = false;
+	private final ReentrantLock configurationLock = new ReentrantLock(true), modemLineEdgeLock = new ReentrantLock(), echoCollisionLock = new ReentrantLock();
 
 	/**
 	 * Opens this serial port for reading and writing with an optional delay time and user-specified device buffer size.
@@ -874,6 +898,29 @@ public class SerialPort
 	private native void quickConfig(long portHandle, int newDataBits, int newStopBits, int newParity);  // Quick-sets the configuration of an already-opened port
 	private native int getLastErrorLocation(long portHandle);			// Returns the source code line location of the latest native code error
 	private native int getLastErrorCode(long portHandle);				// Returns the errno value of the latest native code error
+	private native boolean waitForIdleGap(long portHandle, long idleGapNanos);	// Waits until the line has been idle for the specified time since the last read or new data arrives
+	private native int writeModbusFrame(long portHandle, byte[] frame, int length, long frameGapNanos);	// Writes a Modbus RTU frame after the required inter-frame gap
+	private native int readModbusFrame(long portHandle, byte[] buffer, int expectedLength, long characterGapNanos, long frameGapNanos, int timeout);	// Receives a Modbus RTU frame delimited by line silence
+	private native long getLastReadTimestamp(long portHandle);			// Returns the monotonic arrival time of the most recently read data
+	private native boolean setModemLineCaptureStatus(long portHandle, int lineMask);	// Starts or stops timestamped modem line edge capture
+	private native int readModemLineEdges(long portHandle, long[] timestamps, int[] lines, int[] states);	// Consumes captured modem line edges
+	private native long getLostModemLineEdges(long portHandle);			// Returns the number of modem line edges that could not be captured
+	private native int readEchoCollisions(long portHandle, long[] timestamps, byte[] expected, byte[] received);	// Consumes detected half-duplex echo collisions
+	private native long getLostEchoCollisions(long portHandle);			// Returns the number of echo collisions that could not be recorded
+	private native long getCancelledEchoBytes(long portHandle);			// Returns the number of echoed bytes removed from the received data
+	private native boolean getLineStatistics(long portHandle, long[] statistics);	// Retrieves cumulative data transfer and line error counters
+	private native boolean getRs485Statistics(long portHandle, long[] statistics);	// Retrieves software RS-485 direction control timing histograms
+	private static native int findDelimiters(byte[] buffer, int startIndex, int endIndex, byte[] delimiter, int[] delimiterOffsets);	// Locates message delimiters in a buffer
+	private static native int findLengthFieldFrames(byte[] buffer, int startIndex, int endIndex, byte[] syncWord, int[] frameFormat, int[] framerState, int[] frames);	// Parses length-prefixed frames
+	private static native int encodeCobs(byte[] data, int offset, int length, byte[] encodedData);	// Encodes a COBS frame including its trailing delimiter
+	private static native int decodeCobs(byte[] buffer, int offset, int length);	// Decodes a COBS frame in place
+	private static native int encodeSlip(byte[] data, int offset, int length, byte[] encodedData);	// Encodes a SLIP frame including its END delimiters
+	private static native int decodeSlip(byte[] buffer, int offset, int length);	// Decodes a SLIP frame in place
+	private static native int encodeHdlc(byte[] data, int offset, int length, int accm, int fcsBits, byte[] encodedData);	// Encodes an HDLC frame including its FCS and flags
+	private static native int decodeHdlc(byte[] buffer, int offset, int length, int accm, int fcsBits);	// Decodes and verifies an HDLC frame in place
+	private static native int findPatterns(int[] automaton, byte[] buffer, int startIndex, int endIndex, int maxMatchesPerByte, int[] matcherState, int[] matches);	// Locates pattern matches
+	static native int updateCrc(int[] crcTables, boolean reflected, int crc, byte[] data, int offset, int length);	// Continues a slice-by-8 CRC calculation
+	static native int updateCrcDirect(int[] crcTables, boolean reflected, int crc, ByteBuffer data, int offset, int length);	// Continues a slice-by-8 CRC calculation over a direct buffer
 
 	/**
 	 * Returns the number of bytes available without blocking if {@link #readBytes(byte[], int)} were to be called immediately
@@ -980,6 +1027,204 @@ public class SerialPort
 	 */
 	public final int writeBytes(byte[] buffer, int bytesToWrite) { return writeBytes(buffer, bytesToWrite, 0); }
 
+	/**
+	 * Encodes <i>bytesToWrite</i> bytes from the buffer parameter as a single Consistent Overhead Byte Stuffing (COBS) frame and writes it,
+	 * including its trailing zero delimiter, to the serial port.
+	 * <p>
+	 * Encoding is carried out in native code directly into the buffer that is written to the serial port. The length of the byte buffer minus
+	 * the offset must be greater than or equal to the value passed in for <i>bytesToWrite</i>. If not, a value of -2 will be returned.
+	 * <p>
+	 * Write blocking behavior is identical to that of {@link #writeBytes(byte[], int, int)}.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload.
+	 * @param bytesToWrite The number of payload bytes to encode and write.
+	 * @param offset The buffer index of the first payload byte.
+	 * @return The number of payload bytes written if the entire frame was successfully written, -1 if there was a writing error, or -2 if there was a buffer-size error.
+	 * @see SerialPortCobsListener
+	 */
+	public final int writeCobsFrame(byte[] buffer, int bytesToWrite, int offset)
+	{
+		// Ensure that the buffer is large enough to encode the requested number of bytes
+		if ((bytesToWrite < 0) || (offset < 0) || (bytesToWrite > (buffer.length - offset)))
+			return -2;
+
+		// Encode and write the complete frame
+		byte[] encodedFrame = new byte[bytesToWrite + (bytesToWrite / 254) + 2];
+		int encodedLength = encodeCobs(buffer, offset, bytesToWrite, encodedFrame);
+		return ((encodedLength > 0) && (writeBytes(encodedFrame, encodedLength, 0) == encodedLength)) ? bytesToWrite : -1;
+	}
+
+	/**
+	 * Encodes <i>bytesToWrite</i> bytes from the buffer parameter as a single Consistent Overhead Byte Stuffing (COBS) frame and writes it,
+	 * including its trailing zero delimiter, to the serial port.
+	 * <p>
+	 * The length of the byte buffer must be greater than or equal to the value passed in for <i>bytesToWrite</i>.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload.
+	 * @param bytesToWrite The number of payload bytes to encode and write.
+	 * @return The number of payload bytes written if the entire frame was successfully written, or -1 if there was an error writing to the port.
+	 * @see SerialPortCobsListener
+	 */
+	public final int writeCobsFrame(byte[] buffer, int bytesToWrite) { return writeCobsFrame(buffer, bytesToWrite, 0); }
+
+	/**
+	 * Encodes <i>bytesToWrite</i> bytes from the buffer parameter as a single SLIP frame according to RFC 1055 and writes it to the serial port.
+	 * <p>
+	 * Encoding is carried out in native code directly into the buffer that is written to the serial port. The encoded frame both begins and ends with
+	 * an END byte so that any line noise preceding the frame is flushed by the receiver. The length of the byte buffer minus the offset must be greater
+	 * than or equal to the value passed in for <i>bytesToWrite</i>. If not, a value of -2 will be returned.
+	 * <p>
+	 * Write blocking behavior is identical to that of {@link #writeBytes(byte[], int, int)}.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload.
+	 * @param bytesToWrite The number of payload bytes to encode and write.
+	 * @param offset The buffer index of the first payload byte.
+	 * @return The number of payload bytes written if the entire frame was successfully written, -1 if there was a writing error, or -2 if there was a buffer-size error.
+	 * @see SerialPortSlipListener
+	 */
+	public final int writeSlipFrame(byte[] buffer, int bytesToWrite, int offset)
+	{
+		// Ensure that the buffer is large enough to encode the requested number of bytes
+		if ((bytesToWrite < 0) || (offset < 0) || (bytesToWrite > (buffer.length - offset)))
+			return -2;
+
+		// Encode and write the complete frame
+		byte[] encodedFrame = new byte[(2 * bytesToWrite) + 2];
+		int encodedLength = encodeSlip(buffer, offset, bytesToWrite, encodedFrame);
+		return ((encodedLength > 0) && (writeBytes(encodedFrame, encodedLength, 0) == encodedLength)) ? bytesToWrite : -1;
+	}
+
+	/**
+	 * Encodes <i>bytesToWrite</i> bytes from the buffer parameter as a single SLIP frame according to RFC 1055 and writes it to the serial port.
+	 * <p>
+	 * The length of the byte buffer must be greater than or equal to the value passed in for <i>bytesToWrite</i>.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload.
+	 * @param bytesToWrite The number of payload bytes to encode and write.
+	 * @return The number of payload bytes written if the entire frame was successfully written, or -1 if there was an error writing to the port.
+	 * @see SerialPortSlipListener
+	 */
+	public final int writeSlipFrame(byte[] buffer, int bytesToWrite) { return writeSlipFrame(buffer, bytesToWrite, 0); }
+
+	/**
+	 * Encodes all remaining bytes in the specified buffer as a single SLIP frame according to RFC 1055 and writes it to the serial port.
+	 * <p>
+	 * The position of the buffer is advanced past the payload only if the entire frame was successfully written.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload between its current position and limit.
+	 * @return The number of payload bytes written if the entire frame was successfully written, or -1 if there was an error writing to the port.
+	 * @see SerialPortSlipListener
+	 */
+	public final int writeSlipFrame(ByteBuffer buffer)
+	{
+		// Encode directly from the backing array when available, otherwise from a copy of the remaining bytes
+		int numBytesWritten, bytesToWrite = buffer.remaining();
+		if (buffer.hasArray())
+			numBytesWritten = writeSlipFrame(buffer.array(), bytesToWrite, buffer.arrayOffset() + buffer.position());
+		else
+		{
+			byte[] payload = new byte[bytesToWrite];
+			buffer.duplicate().get(payload);
+			numBytesWritten = writeSlipFrame(payload, bytesToWrite, 0);
+		}
+		if (numBytesWritten == bytesToWrite)
+			buffer.position(buffer.limit());
+		return (numBytesWritten == bytesToWrite) ? numBytesWritten : -1;
+	}
+
+	/**
+	 * Encodes <i>bytesToWrite</i> bytes from the buffer parameter as a single frame using asynchronous HDLC-like framing according to RFC 1662
+	 * and writes it to the serial port.
+	 * <p>
+	 * The frame check sequence is calculated and all required bytes are escaped in native code directly into the buffer that is written to the
+	 * serial port. The encoded frame both begins and ends with a flag byte. The length of the byte buffer minus the offset must be greater than or
+	 * equal to the value passed in for <i>bytesToWrite</i>. If not, a value of -2 will be returned.
+	 * <p>
+	 * Write blocking behavior is identical to that of {@link #writeBytes(byte[], int, int)}.
+	 *
+	 * @param buffer The buffer containing the unencoded frame payload.
+	 * @param bytesToWrite The number of payload bytes to encode and write.
+	 * @param offset The buffer index of the first payload byte.
+	 * @param fcsBits The size of the frame check sequence to append in bits: 16, 32, or 0 to omit the frame check sequence.
+	 * @param transmitAccm The transmit async control character map, where bit <i>n</i> indicates that control character <i>n</i> must be escaped.
+	 * @return The number of payload bytes written if the entire frame was successfully written, -1 if there was a writing error, or -2 if there was a buffer-size error.
+	 * @see SerialPortHdlcListener
+	 */
+	public final int writeHdlcFrame(byte[] buffer, int bytesToWrite, int offset, int fcsBits, int transmitAccm)
+	{
+		// Ensure that the buffer is large enough to encode the requested number of bytes
+		if ((bytesToWrite < 0) || (offset < 0) || (bytesToWrite > (buffer.length - offset)))
+			return -2;
+
+		// Encode and write the complete frame
+		byte[] encodedFrame = new byte[(2 * (bytesToWrite + 4)) + 2];
+		int encodedLength = encodeHdlc(buffer, offset, bytesToWrite, transmitAccm, fcsBits, encodedFrame);
+		return ((encodedLength > 0) && (writeBytes(encodedFrame, encodedLength, 0) == encodedLength)) ? bytesToWrite : -1;
+	}
+
+	/**
+	 * Writes a request to the serial port and returns a {@link SerialPortTransaction} that will be completed by its matching response.
+	 * <p>
+	 * The response matcher is automatically registered as a data listener the first time it is used, after which all response framing and matching
+	 * is carried out by the internal event thread without any further reads by the calling thread. Depending on the matcher, transactions are either
+	 * carried out one at a time, with each request only being written once the previous transaction has completed, or pipelined by matching a
+	 * correlation field in each response against the outstanding requests. Any received frames that do not match an outstanding transaction are
+	 * delivered to the matcher as regular data events.
+	 * <p>
+	 * The request array is copied, so it may be reused as soon as this method returns. If the request cannot be written, if no matching response
+	 * is received within the specified timeout, or if the response matcher is removed or the port is closed before the transaction completes, the
+	 * transaction will complete with an exception.
+	 *
+	 * @param request The complete request to write to the serial port.
+	 * @param matcher The {@link SerialPortResponseMatcher} used to frame and match the response.
+	 * @param timeout The number of milliseconds to wait for a matching response once the request has been written.
+	 * @return A future that completes with the matching response.
+	 * @see SerialPortTransaction
+	 * @see SerialPortResponseMatcher
+	 */
+	public final SerialPortTransaction transact(byte[] request, SerialPortResponseMatcher matcher, int timeout)
+	{
+		// Register the response matcher if it is not already listening for responses
+		SerialPortTransaction transaction = new SerialPortTransaction(request.clone(), Math.max(timeout, 1));
+		SerialPortTransactionQueue transactionQueue = null;
+		configurationLock.lock();
+		try
+		{
+			if ((serialEventListener == null) || (serialEventListener.getDataFramer(matcher) == null))
+				addDataListener(matcher);
+			SerialPortDataFramer dataFramer = (serialEventListener != null) ? serialEventListener.getDataFramer(matcher) : null;
+			transactionQueue = (dataFramer != null) ? dataFramer.transactionQueue : null;
+		}
+		finally { configurationLock.unlock(); }
+
+		// Write the request or queue it behind any outstanding transactions
+		if ((portHandle == 0) || (transactionQueue == null))
+			transaction.fail(new SerialPortIOException("The port must be opened before starting a transaction"));
+		else
+			transactionQueue.submit(transaction);
+		return transaction;
+	}
+
+	// Writes a complete Modbus RTU frame once the bus has been silent for at least the specified inter-frame gap
+	final int writeModbusFrame(byte[] frame, int length, long frameGapNanos) { return ((portHandle != 0) && (androidPort == null)) ? writeModbusFrame(portHandle, frame, length, frameGapNanos) : -1; }
+
+	// Receives a single Modbus RTU frame, returning 0 on timeout, -1 on error, or -2 if the frame violated the inter-character timing rules
+	final int readModbusFrame(byte[] buffer, int expectedLength, long characterGapNanos, long frameGapNanos, int timeout)
+	{
+		return ((portHandle != 0) && (androidPort == null)) ? readModbusFrame(portHandle, buffer, expectedLength, characterGapNanos, frameGapNanos, timeout) : -1;
+	}
+
+	// Returns the duration of a single character at the current serial port settings
+	final double getCharacterTimeNanos()
+	{
+		double bitsPerCharacter = 1 + dataBits + ((parity != SerialPort.NO_PARITY) ? 1 : 0) +
+				((stopBits == SerialPort.ONE_POINT_FIVE_STOP_BITS) ? 1.5 : ((stopBits == SerialPort.TWO_STOP_BITS) ? 2 : 1));
+		return (bitsPerCharacter * 1000000000.0) / Math.max(baudRate, 1);
+	}
+
+	// Returns the configured RS-485 delay between the last transmitted bit and the release of the bus
+	final int getRs485DelayAfter() { return rs485DelayAfter; }
+
 	/**
 	 * Returns the underlying transmit buffer size used by the serial port device driver. The device or operating system may choose to misrepresent this value.
 	 * <p>
@@ -998,6 +1243,42 @@ public class SerialPort
 	 */
 	public final int getDeviceReadBufferSize() { return receiveDeviceQueueSize; }
 
+	/**
+	 * Returns a snapshot of the cumulative data transfer and line error counters for this serial port.
+	 * <p>
+	 * This method is inexpensive and does not interfere with the data path, so it may be called periodically to compute throughput
+	 * and error rates. Driver-maintained line counters are only available on Linux.
+	 *
+	 * @return A snapshot of the line statistics for this port, or null if the port is not open.
+	 * @see SerialPortLineStatistics
+	 */
+	public final SerialPortLineStatistics getLineStatistics()
+	{
+		if ((portHandle == 0) || (androidPort != null))
+			return null;
+		long[] counters = new long[11];
+		boolean driverCountersAvailable = getLineStatistics(portHandle, counters);
+		return new SerialPortLineStatistics(counters, driverCountersAvailable, System.nanoTime());
+	}
+
+	/**
+	 * Returns a snapshot of the bus turnaround timing measured by software RS-485 direction control for this serial port.
+	 * <p>
+	 * Timing is only recorded while software direction control is enabled using {@link #setRs485SoftwareDirectionControl(boolean)}
+	 * and RS-485 mode is enabled, and it is reset whenever the port is opened.
+	 *
+	 * @return A snapshot of the RS-485 timing statistics for this port, or null if the port is not open.
+	 * @see SerialPortRs485Statistics
+	 */
+	public final SerialPortRs485Statistics getRs485Statistics()
+	{
+		if ((portHandle == 0) || (androidPort != null))
+			return null;
+		long[] counters = new long[4 + (2 * SerialPortRs485Statistics.HISTOGRAM_BUCKETS)];
+		boolean softwareControlActive = getRs485Statistics(portHandle, counters);
+		return new SerialPortRs485Statistics(counters, softwareControlActive, System.nanoTime());
+	}
+
 	/**
 	 * Sets the BREAK signal on the serial control line.
 	 * 
@@ -1042,6 +1323,13 @@ public class SerialPort
 		return (androidPort != null) ? androidPort.clearRTS() : ((portHandle == 0) || clearRTS(portHandle));
 	}
 
+	// Pauses or resumes the sending device using software input flow control, since RTS is owned by the driver whenever RTS flow control or RS-485 mode is enabled
+	final void throttleInput(boolean throttle)
+	{
+		if ((flowControl & SerialPort.FLOW_CONTROL_XONXOFF_IN_ENABLED) > 0)
+			writeBytes(new byte[] { throttle ? xoffStopChar : xonStartChar }, 1);
+	}
+
 	/**
 	 * Asserts DTR by setting the line's state to 1.
 	 * <ul>
@@ -1128,6 +1416,132 @@ public class SerialPort
 	 */
 	public final boolean getRI() { return (portHandle != 0) && ((androidPort != null) ? androidPort.getRI() : getRI(portHandle)); }
 
+	/**
+	 * Starts capturing timestamped transitions of the specified modem control lines.
+	 * <p>
+	 * Each transition is timestamped in native code as soon as it is reported by the operating system and is stored in a lock-free
+	 * ring buffer holding up to 128 transitions, from which it can be retrieved using {@link #readModemLineEdges()}. This makes it
+	 * possible to precisely time external signals, such as a one-pulse-per-second (1PPS) GPS output connected to the DCD line.
+	 * <p>
+	 * Transitions that could not be individually observed, either because they occurred too quickly in succession or because the ring
+	 * buffer was full, are counted and can be retrieved using {@link #getLostModemLineEdgeCount()}.
+	 * <p>
+	 * The <i>controlLines</i> parameter should be a bitmask containing one or more of the following items OR'd together:
+	 * <p>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_CARRIER_DETECT}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_CTS}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_DSR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_RING_INDICATOR}
+	 * <p>
+	 * Any previously captured transitions will be discarded. Capturing is automatically stopped when the port is closed.
+	 * <p>
+	 * Please note that this functionality is currently only available on Linux using device drivers that support modem line interrupts.
+	 *
+	 * @param controlLines A bitmask of the control lines whose transitions should be captured.
+	 * @return Whether transition capturing was successfully started.
+	 */
+	public final boolean startModemLineEdgeCapture(int controlLines)
+	{
+		controlLines &= (LISTENING_EVENT_CARRIER_DETECT | LISTENING_EVENT_CTS | LISTENING_EVENT_DSR | LISTENING_EVENT_RING_INDICATOR);
+		modemLineEdgeLock.lock();
+		try { return (portHandle != 0) && (androidPort == null) && (controlLines != 0) && setModemLineCaptureStatus(portHandle, controlLines); }
+		finally { modemLineEdgeLock.unlock(); }
+	}
+
+	/**
+	 * Stops capturing timestamped transitions of the modem control lines.
+	 *
+	 * @see #startModemLineEdgeCapture(int)
+	 */
+	public final void stopModemLineEdgeCapture()
+	{
+		modemLineEdgeLock.lock();
+		try
+		{
+			if ((portHandle != 0) && (androidPort == null))
+				setModemLineCaptureStatus(portHandle, 0);
+		}
+		finally { modemLineEdgeLock.unlock(); }
+	}
+
+	/**
+	 * Retrieves and removes all modem control line transitions captured since the last call to this method.
+	 * <p>
+	 * Transitions are returned in the order in which they occurred.
+	 *
+	 * @return An array of captured control line transitions, which will be empty if none are available.
+	 * @see #startModemLineEdgeCapture(int)
+	 */
+	public final SerialPortModemLineEdge[] readModemLineEdges()
+	{
+		modemLineEdgeLock.lock();
+		try
+		{
+			if ((portHandle == 0) || (androidPort != null))
+				return new SerialPortModemLineEdge[0];
+			long[] timestamps = new long[128];
+			int[] lines = new int[timestamps.length], states = new int[timestamps.length];
+			SerialPortModemLineEdge[] edges = new SerialPortModemLineEdge[Math.max(readModemLineEdges(portHandle, timestamps, lines, states), 0)];
+			for (int i = 0; i < edges.length; ++i)
+				edges[i] = new SerialPortModemLineEdge(this, lines[i], states[i] != 0, timestamps[i]);
+			return edges;
+		}
+		finally { modemLineEdgeLock.unlock(); }
+	}
+
+	/**
+	 * Returns the number of modem control line transitions that occurred but could not be individually captured since capturing was
+	 * last started.
+	 *
+	 * @return The number of modem control line transitions that were lost.
+	 * @see #startModemLineEdgeCapture(int)
+	 */
+	public final long getLostModemLineEdgeCount() { return ((portHandle != 0) && (androidPort == null)) ? getLostModemLineEdges(portHandle) : 0; }
+
+	/**
+	 * Retrieves and removes all half-duplex echo collisions detected since the last call to this method.
+	 * <p>
+	 * Each collision describes a received byte that arrived in place of the echo of a transmitted byte but did not match it. Collisions
+	 * are returned in the order in which they were detected, and are stored natively in a ring buffer holding up to 64 entries.
+	 *
+	 * @return An array of detected collisions, which will be empty if none are available.
+	 * @see #setEchoCancellation(boolean, int)
+	 */
+	public final SerialPortCollision[] readCollisions()
+	{
+		echoCollisionLock.lock();
+		try
+		{
+			if ((portHandle == 0) || (androidPort != null))
+				return new SerialPortCollision[0];
+			long[] timestamps = new long[64];
+			byte[] expected = new byte[timestamps.length], received = new byte[timestamps.length];
+			SerialPortCollision[] collisions = new SerialPortCollision[Math.max(readEchoCollisions(portHandle, timestamps, expected, received), 0)];
+			for (int i = 0; i < collisions.length; ++i)
+				collisions[i] = new SerialPortCollision(this, expected[i], received[i], timestamps[i]);
+			return collisions;
+		}
+		finally { echoCollisionLock.unlock(); }
+	}
+
+	/**
+	 * Returns the number of half-duplex echo collisions that were detected but could not be recorded because the collision buffer was full
+	 * since the port was opened.
+	 *
+	 * @return The number of echo collisions that were lost.
+	 * @see #readCollisions()
+	 */
+	public final long getLostCollisionCount() { return ((portHandle != 0) && (androidPort == null)) ? getLostEchoCollisions(portHandle) : 0; }
+
+	/**
+	 * Returns the number of echoed bytes that have been removed from the received data stream by half-duplex echo cancellation since the
+	 * port was opened, including echoed bytes that were reported as collisions.
+	 *
+	 * @return The number of cancelled echo bytes.
+	 * @see #setEchoCancellation(boolean, int)
+	 */
+	public final long getCancelledEchoByteCount() { return ((portHandle != 0) && (androidPort == null)) ? getCancelledEchoBytes(portHandle) : 0; }
+
 	// SerialPort Constructors
 	private SerialPort() {}
 	private SerialPort(String port, String friendly, String description, String location, String serial, String manufacture, String driver, int vid, int pid)
@@ -1154,35 +1568,82 @@ public class SerialPort
 	 * The {@link SerialPortPacketListener} interface <b>should</b> be used if you plan to use event-based reading of <i>full</i> data packets over the serial port.
 	 * Otherwise, the simpler {@link SerialPortDataListener} or {@link SerialPortDataListenerWithExceptions} may be used.
 	 * <p>
-	 * Only one listener can be registered at a time; however, that listener can be used to detect multiple types of serial port events.
+	 * Any of these listeners may additionally implement the {@link SerialPortDataBufferListener} interface to receive data as a view into a reused internal
+	 * buffer, without the memory allocations that would otherwise be required for each received chunk, packet, or message. Similarly, the
+	 * {@link SerialPortMessageBatchListener} interface may be implemented to receive all packets or messages framed from a single read as one batch.
+	 * The {@link SerialPortPatternListener} interface may be implemented to be notified whenever any of a set of byte patterns is received, and the
+	 * {@link SerialPortSyncPacketListener} interface may be used in place of {@link SerialPortPacketListener} to automatically resynchronize packet
+	 * framing using a synchronization word at the start of each packet. Frames with a length field in their headers may be received using the
+	 * {@link SerialPortLengthFieldListener} interface, and frames that are delimited by periods of line silence may be received using the
+	 * {@link SerialPortIdleGapListener} interface. COBS-encoded frames may be received and decoded using the {@link SerialPortCobsListener} interface,
+	 * SLIP-encoded frames using the {@link SerialPortSlipListener} interface, and frames using asynchronous HDLC-like framing with frame check
+	 * sequence verification using the {@link SerialPortHdlcListener} interface. The {@link SerialPortFrameCrcListener} interface may be combined with
+	 * any of these framing listeners to discard frames whose trailing CRC does not match their contents.
+	 * <p>
+	 * Multiple listeners may be registered at the same time, each using its own type of message framing. All listeners are fed from the same reads
+	 * of the serial port, so each one receives the complete incoming data stream without the data being read more than once. Each listener will only
+	 * be notified of the events that it requests; however, if any registered listener requests {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED} events,
+	 * no {@link SerialPort#LISTENING_EVENT_DATA_AVAILABLE} events will be generated since all incoming data will be read automatically.
 	 * Refer to {@link SerialPortDataListener}, {@link SerialPortDataListenerWithExceptions}, {@link SerialPortPacketListener}, {@link SerialPortMessageListener}, and {@link SerialPortMessageListenerWithExceptions} for more information.
 	 * <p>
 	 * Note that if you register to listen for {@link SerialPort#LISTENING_EVENT_PORT_DISCONNECTED} events, you <b>CANNOT</b> call <code>openPort()</code> to re-open a disconnected port from within the <code>serialEvent()</code>
 	 * handler. Port re-opening <b>must</b> be done within your own application context.
 	 *
 	 * @param listener A {@link SerialPortDataListener}, {@link SerialPortDataListenerWithExceptions}, {@link SerialPortPacketListener}, {@link SerialPortMessageListener}, or {@link SerialPortMessageListenerWithExceptions} implementation to be used for event-based serial port communications.
-	 * @return Whether the listener was successfully registered with the serial port.
+	 * @return Whether the listener was successfully registered with the serial port, or false if it was already registered.
 	 * @see SerialPortDataListener
 	 * @see SerialPortDataListenerWithExceptions
 	 * @see SerialPortPacketListener
 	 * @see SerialPortMessageListener
 	 * @see SerialPortMessageListenerWithExceptions
+	 * @see SerialPortDataBufferListener
+	 * @see SerialPortMessageBatchListener
+	 * @see SerialPortPatternListener
+	 * @see SerialPortSyncPacketListener
+	 * @see SerialPortLengthFieldListener
+	 * @see SerialPortIdleGapListener
+	 * @see SerialPortCobsListener
+	 * @see SerialPortSlipListener
+	 * @see SerialPortHdlcListener
+	 * @see SerialPortFrameCrcListener
 	 */
-	public final boolean addDataListener(SerialPortDataListener listener)
+	public final boolean addDataListener(SerialPortDataListener listener) { return addDataListener(listener, null); }
+
+	/**
+	 * Adds a {@link SerialPortDataListener} to the serial port interface whose callbacks will be invoked using the specified {@link java.util.concurrent.Executor}.
+	 * <p>
+	 * This method behaves identically to {@link #addDataListener(SerialPortDataListener)}, except that the internal event thread will only read and frame
+	 * incoming data, while all listener callbacks are handed off to the specified executor. This allows a slow listener to process previously received
+	 * data while new data continues to be read from the serial port. Callbacks for this port are always invoked one at a time in the order in which their
+	 * events occurred, regardless of how many threads the executor uses, so a single executor may safely be shared among many serial ports.
+	 * <p>
+	 * Since the internal buffers of this library may be reused as soon as a callback has been handed off, {@link SerialPortDataBufferListener}s and
+	 * {@link SerialPortMessageBatchListener}s registered using this method will receive a private copy of their data in place of a view into an internal buffer.
+	 * <p>
+	 * If an exception is thrown from within a listener callback, that listener will be removed from the serial port while any other registered listeners
+	 * continue to receive events, and the exception will be passed to the <code>catchException()</code> method of a {@link SerialPortDataListenerWithExceptions}
+	 * or {@link SerialPortMessageListenerWithExceptions}.
+	 *
+	 * @param listener A {@link SerialPortDataListener} implementation to be used for event-based serial port communications.
+	 * @param executor The {@link java.util.concurrent.Executor} used to invoke all listener callbacks, or <i>null</i> to invoke them directly from the internal event thread.
+	 * @return Whether the listener was successfully registered with the serial port.
+	 * @see #addDataListener(SerialPortDataListener)
+	 * @see #setReceiveQueuePolicy(int, int)
+	 */
+	public final boolean addDataListener(SerialPortDataListener listener, Executor executor)
 	{
 		configurationLock.lock();
 		try
 		{
-			if (userDataListener != null)
+			if (serialEventListener == null)
+			{
+				receiveQueueDroppedEvents = receiveQueueDroppedBytes = receiveQueueCoalescedEvents = discardedMessageCount = packetSyncLossCount = packetSyncDiscardedBytes = framingErrorCount = malformedEscapeCount = checksumErrorCount = 0;
+				receiveQueueHighWaterMark = 0;
+				serialEventListener = new SerialPortEventListener();
+			}
+			if (!serialEventListener.addDataFramer(listener, executor))
 				return false;
-			userDataListener = listener;
-			eventFlags = listener.getListeningEvents();
-			if ((eventFlags & SerialPort.LISTENING_EVENT_DATA_RECEIVED) > 0)
-				eventFlags |= SerialPort.LISTENING_EVENT_DATA_AVAILABLE;
-			serialEventListener = ((userDataListener instanceof SerialPortPacketListener) ? new SerialPortEventListener(((SerialPortPacketListener)userDataListener).getPacketSize()) :
-				((userDataListener instanceof SerialPortMessageListener) ?
-						new SerialPortEventListener(((SerialPortMessageListener)userDataListener).getMessageDelimiter(), ((SerialPortMessageListener)userDataListener).delimiterIndicatesEndOfMessage()) :
-							new SerialPortEventListener()));
+			eventFlags = serialEventListener.getListeningEvents();
 			if (portHandle != 0)
 			{
 				if (androidPort != null)
@@ -1197,7 +1658,188 @@ public class SerialPort
 	}
 
 	/**
-	 * Flushes any already-received data from the registered {@link SerialPortDataListener} that has not yet triggered an event.
+	 * Sets the {@link SerialPortBufferPool} from which the data arrays of received {@link SerialPortEvent}s will be taken.
+	 * <p>
+	 * When a buffer pool is set, applications should call {@link SerialPortEvent#release()} on every data-received event once its
+	 * data is no longer needed, allowing the underlying array to be reused for a later event instead of allocating a new one.
+	 * A single buffer pool may be shared among multiple serial ports.
+	 * <p>
+	 * This setting has no effect on listeners implementing {@link SerialPortDataBufferListener}, which never allocate event data.
+	 *
+	 * @param bufferPool The buffer pool to use for received event data, or <i>null</i> to allocate a new array for every event.
+	 * @see SerialPortBufferPool
+	 * @see SerialPortEvent#release()
+	 */
+	public final void setEventBufferPool(SerialPortBufferPool bufferPool) { eventBufferPool = bufferPool; }
+
+	/**
+	 * Returns the {@link SerialPortBufferPool} from which the data arrays of received {@link SerialPortEvent}s are taken.
+	 *
+	 * @return The current event buffer pool, or <i>null</i> if no buffer pool has been set.
+	 * @see #setEventBufferPool(SerialPortBufferPool)
+	 */
+	public final SerialPortBufferPool getEventBufferPool() { return eventBufferPool; }
+
+	/**
+	 * Sets the maximum number of pending data events and the policy to apply when that limit is reached for a listener registered using
+	 * {@link #addDataListener(SerialPortDataListener, java.util.concurrent.Executor)}.
+	 * <p>
+	 * Received data events are placed into a queue between the internal thread that reads from the serial port and the executor that invokes
+	 * the listener callbacks. When the number of queued data events reaches the specified capacity, one of the following policies is applied:
+	 * <p>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link #RECEIVE_QUEUE_BLOCK}: Stop reading from the serial port until a queued event has been processed<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link #RECEIVE_QUEUE_DROP_OLDEST}: Discard the oldest queued data event to make room for the newest one<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link #RECEIVE_QUEUE_DROP_NEWEST}: Discard the newest data event<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link #RECEIVE_QUEUE_COALESCE}: Merge the newest data event into the most recently queued one<br>
+	 * <p>
+	 * When blocking, unread data will accumulate in the device driver, allowing any configured hardware or software flow control to throttle
+	 * the sending device. Only raw data events and {@link SerialPortMessageBatchListener} batches can be coalesced; if the newest event cannot be
+	 * coalesced, the {@link #RECEIVE_QUEUE_COALESCE} policy will block instead. Events that do not contain data are never dropped or delayed.
+	 * <p>
+	 * Listeners registered without an executor are invoked directly from the reading thread, which naturally blocks reading until each callback returns.
+	 *
+	 * @param queuePolicy The overflow policy to apply when the receive queue is full.
+	 * @param maxQueuedEvents The maximum number of data events that may be queued, or 0 for an unbounded queue.
+	 * @see #RECEIVE_QUEUE_BLOCK
+	 * @see #RECEIVE_QUEUE_DROP_OLDEST
+	 * @see #RECEIVE_QUEUE_DROP_NEWEST
+	 * @see #RECEIVE_QUEUE_COALESCE
+	 */
+	public final void setReceiveQueuePolicy(int queuePolicy, int maxQueuedEvents)
+	{
+		receiveQueuePolicy = queuePolicy;
+		receiveQueueCapacity = Math.max(maxQueuedEvents, 0);
+	}
+
+	/**
+	 * Sets the maximum number of bytes that a partially received message may contain before it is discarded.
+	 * <p>
+	 * This limit applies to {@link SerialPortMessageListener}s and prevents unbounded memory growth if a message delimiter is never received.
+	 * Discarded messages are reported by {@link #getDiscardedMessageCount()}, and their bytes are included in {@link #getReceiveQueueDroppedBytes()}.
+	 *
+	 * @param maxMessageBytes The maximum size of a received message in bytes, or 0 to allow messages of any size.
+	 */
+	public final void setMaximumMessageSize(int maxMessageBytes) { maximumMessageSize = Math.max(maxMessageBytes, 0); }
+
+	/**
+	 * Returns the overflow policy applied when the receive queue is full.
+	 *
+	 * @return The current receive queue overflow policy.
+	 * @see #setReceiveQueuePolicy(int, int)
+	 */
+	public final int getReceiveQueuePolicy() { return receiveQueuePolicy; }
+
+	/**
+	 * Returns the maximum number of data events that may be queued for a listener before the receive queue overflow policy is applied.
+	 *
+	 * @return The receive queue capacity, or 0 if the receive queue is unbounded.
+	 * @see #setReceiveQueuePolicy(int, int)
+	 */
+	public final int getReceiveQueueCapacity() { return receiveQueueCapacity; }
+
+	/**
+	 * Returns the maximum number of bytes that a partially received message may contain before it is discarded.
+	 *
+	 * @return The maximum message size in bytes, or 0 if messages of any size are allowed.
+	 * @see #setMaximumMessageSize(int)
+	 */
+	public final int getMaximumMessageSize() { return maximumMessageSize; }
+
+	/**
+	 * Returns the number of data events that have been dropped by the receive queue since the first of the currently registered data listeners was added.
+	 *
+	 * @return The number of dropped data events.
+	 */
+	public final long getReceiveQueueDroppedEvents() { return receiveQueueDroppedEvents; }
+
+	/**
+	 * Returns the number of received bytes that have been dropped by the receive queue or discarded as part of an oversized message since
+	 * the first of the currently registered data listeners was added.
+	 *
+	 * @return The number of dropped data bytes.
+	 */
+	public final long getReceiveQueueDroppedBytes() { return receiveQueueDroppedBytes; }
+
+	/**
+	 * Returns the number of data events that have been merged into previously queued events since the first of the currently registered data listeners was added.
+	 *
+	 * @return The number of coalesced data events.
+	 */
+	public final long getReceiveQueueCoalescedEvents() { return receiveQueueCoalescedEvents; }
+
+	/**
+	 * Returns the largest number of callbacks that have been pending in the receive queue at any one time since the first of the currently registered data listeners was added.
+	 *
+	 * @return The receive queue high-water mark.
+	 */
+	public final int getReceiveQueueHighWaterMark() { return receiveQueueHighWaterMark; }
+
+	/**
+	 * Returns the number of partially received messages that have been discarded for exceeding the maximum message size since the first
+	 * of the currently registered data listeners was added.
+	 *
+	 * @return The number of discarded oversized messages.
+	 * @see #setMaximumMessageSize(int)
+	 */
+	public final long getDiscardedMessageCount() { return discardedMessageCount; }
+
+	/**
+	 * Returns the number of times that a {@link SerialPortSyncPacketListener} or {@link SerialPortLengthFieldListener} has lost packet synchronization
+	 * since the first of the currently registered data listeners was added.
+	 * <p>
+	 * Synchronization is considered lost whenever a packet boundary does not begin with the synchronization word or contains an invalid length field,
+	 * and it is regained as soon as the next complete packet has been delivered.
+	 *
+	 * @return The number of packet synchronization losses.
+	 * @see SerialPortSyncPacketListener
+	 * @see SerialPortLengthFieldListener
+	 */
+	public final long getPacketSyncLossCount() { return packetSyncLossCount; }
+
+	/**
+	 * Returns the number of received bytes that have been discarded while resynchronizing a {@link SerialPortSyncPacketListener} or
+	 * {@link SerialPortLengthFieldListener} since the first of the currently registered data listeners was added.
+	 *
+	 * @return The number of bytes discarded during packet resynchronization.
+	 * @see SerialPortSyncPacketListener
+	 * @see SerialPortLengthFieldListener
+	 */
+	public final long getPacketSyncDiscardedBytes() { return packetSyncDiscardedBytes; }
+
+	/**
+	 * Returns the number of received frames that have been discarded because they could not be decoded since the first of the currently
+	 * registered data listeners was added.
+	 *
+	 * @return The number of frames discarded due to framing or encoding errors.
+	 * @see SerialPortCobsListener
+	 * @see SerialPortSlipListener
+	 * @see SerialPortHdlcListener
+	 * @see SerialPortFrameCrcListener
+	 */
+	public final long getFramingErrorCount() { return framingErrorCount; }
+
+	/**
+	 * Returns the number of received frames that have been discarded because they contained an invalid escape sequence since the first of the
+	 * currently registered data listeners was added.
+	 *
+	 * @return The number of frames containing malformed escape sequences.
+	 * @see SerialPortSlipListener
+	 * @see SerialPortHdlcListener
+	 */
+	public final long getMalformedEscapeCount() { return malformedEscapeCount; }
+
+	/**
+	 * Returns the number of received frames that have been discarded due to an invalid checksum, CRC, or frame check sequence since the first of
+	 * the currently registered data listeners was added.
+	 *
+	 * @return The number of frames that failed checksum verification.
+	 * @see SerialPortHdlcListener
+	 * @see SerialPortFrameCrcListener
+	 */
+	public final long getChecksumErrorCount() { return checksumErrorCount; }
+
+	/**
+	 * Flushes any already-received data from all registered {@link SerialPortDataListener}s that has not yet triggered an event.
 	 */
 	public final void flushDataListener()
 	{
@@ -1211,7 +1853,7 @@ public class SerialPort
 	}
 
 	/**
-	 * Removes the associated {@link SerialPortDataListener} from the serial port interface.
+	 * Removes all associated {@link SerialPortDataListener}s from the serial port interface.
 	 */
 	public final void removeDataListener()
 	{
@@ -1224,7 +1866,37 @@ public class SerialPort
 				serialEventListener.stopListening();
 				serialEventListener = null;
 			}
-			userDataListener = null;
+		}
+		finally { configurationLock.unlock(); }
+	}
+
+	/**
+	 * Removes the specified {@link SerialPortDataListener} from the serial port interface, leaving any other registered listeners active.
+	 *
+	 * @param listener The previously registered {@link SerialPortDataListener} to remove.
+	 * @return Whether the listener was registered with the serial port.
+	 */
+	public final boolean removeDataListener(SerialPortDataListener listener)
+	{
+		configurationLock.lock();
+		try
+		{
+			if ((serialEventListener == null) || !serialEventListener.removeDataFramer(listener))
+				return false;
+			if (serialEventListener.getNumDataFramers() == 0)
+				removeDataListener();
+			else
+			{
+				eventFlags = serialEventListener.getListeningEvents();
+				if (portHandle != 0)
+				{
+					if (androidPort != null)
+						androidPort.configPort(this);
+					else
+						configPort(portHandle);
+				}
+			}
+			return true;
 		}
 		finally { configurationLock.unlock(); }
 	}
@@ -1271,6 +1943,18 @@ public class SerialPort
 	 */
 	public final InputStream getInputStreamWithSuppressedTimeoutExceptions() { return new SerialPortInputStream(true); }
 
+	/**
+	 * Returns a {@link SerialPortPublisher} that delivers the data received by this serial port according to subscriber demand.
+	 * <p>
+	 * While a subscriber has no outstanding demand, data will not be read from the serial port, and any configured RTS or XON/XOFF input
+	 * flow control will be used to pause the sending device. Each publisher supports a single subscriber, which is registered as
+	 * one of this port's {@link SerialPortDataListener}s while it is active.
+	 *
+	 * @return A {@link SerialPortPublisher} associated with this serial port.
+	 * @see SerialPortPublisher
+	 */
+	public final SerialPortPublisher getDataPublisher() { return new SerialPortPublisher(this); }
+
 	/**
 	 * Returns an {@link java.io.OutputStream} object associated with this serial port.
 	 * <p>
@@ -1820,6 +2504,101 @@ public class SerialPort
 		finally { configurationLock.unlock(); }
 	}
 
+	/**
+	 * Enables or disables software RS-485 direction control for the device.
+	 * <p>
+	 * Many USB-to-serial adapters do not support kernel RS-485 mode or only toggle RTS with millisecond-level jitter. When software
+	 * direction control is enabled and RS-485 mode has been enabled using {@link #setRs485ModeParameters(boolean, boolean, boolean, boolean, int, int)},
+	 * every write will be carried out entirely in native code as follows: RTS is set to its active level, the configured delay-before-send
+	 * elapses, all bytes are written, the native code waits for the final stop bit to leave the transmitter, and RTS is released once the
+	 * configured delay-after-send has elapsed. The end of transmission is detected using the UART transmitter empty flag where the driver
+	 * supports the Linux <i>TIOCSERGETLSR</i> request, and otherwise from the driver's output queue and the time required to clock out
+	 * every written character at the configured baud rate. Kernel or driver-based RS-485 direction control is disabled while software
+	 * direction control is enabled.
+	 * <p>
+	 * Since the bus must be released after each transmission, all writes block until transmission has completed, regardless of the
+	 * configured write timeout mode. The resulting bus turnaround timing can be verified using {@link #getRs485Statistics()}.
+	 *
+	 * @param useSoftwareControl Whether to control the RS-485 transmitter direction in software.
+	 * @return Whether the port configuration is valid or disallowed on this system (only meaningful after the port is already opened).
+	 * @see #getRs485Statistics()
+	 */
+	public final boolean setRs485SoftwareDirectionControl(boolean useSoftwareControl)
+	{
+		configurationLock.lock();
+		try
+		{
+			rs485SoftwareControl = useSoftwareControl;
+
+			if (portHandle != 0)
+			{
+				if (safetySleepTimeMS > 0)
+					try { Thread.sleep(safetySleepTimeMS); } catch (Exception e) { Thread.currentThread().interrupt(); }
+				return (androidPort != null) ? androidPort.configPort(this) : configPort(portHandle);
+			}
+			return true;
+		}
+		finally { configurationLock.unlock(); }
+	}
+
+	/**
+	 * Returns whether software RS-485 direction control has been requested for this port.
+	 *
+	 * @return Whether the RS-485 transmitter direction is controlled in software.
+	 * @see #setRs485SoftwareDirectionControl(boolean)
+	 */
+	public final boolean isRs485SoftwareDirectionControlEnabled() { return rs485SoftwareControl; }
+
+	/**
+	 * Enables or disables native half-duplex echo cancellation and collision detection for the device.
+	 * <p>
+	 * On two-wire RS-485, single-wire and other half-duplex buses, the receiver hears every byte that is transmitted. When echo cancellation
+	 * is enabled, the native library records each transmitted byte immediately before it is written and removes its echo from the received
+	 * data before it is returned by any of the <code>readBytes()</code> methods or delivered to a {@link SerialPortDataListener}. Since
+	 * only one device may drive a half-duplex bus at a time, each byte received while an echo is still expected is assumed to occupy the
+	 * position of the corresponding transmitted byte. If the two bytes differ, another device was transmitting at the same time, so the
+	 * byte is removed and a timestamped collision is recorded, which can be retrieved using {@link #readCollisions()}. Collisions will also
+	 * be reported as {@link #LISTENING_EVENT_COLLISION} events to any data listener that registered for them, as long as received data is
+	 * being read by the event listener using {@link #LISTENING_EVENT_DATA_RECEIVED}.
+	 * <p>
+	 * If no echo arrives within the time required to transmit the outstanding bytes plus the specified <i>newEchoTimeout</i>, such as when
+	 * the receiver is disabled while transmitting, the outstanding echo is discarded and all subsequently received bytes are delivered
+	 * normally. Modbus RTU frames written using {@link SerialPortModbusMaster} or {@link SerialPortModbusSlave} have their entire echo
+	 * consumed before the write returns, and a collision causes the frame to be treated as not having been sent.
+	 *
+	 * @param useEchoCancellation Whether to cancel the echo of transmitted data and detect bus collisions.
+	 * @param newEchoTimeout The number of milliseconds to wait for the echo of transmitted data after it should have been received.
+	 * @return Whether the port configuration is valid or disallowed on this system (only meaningful after the port is already opened).
+	 * @see #readCollisions()
+	 * @see #getCancelledEchoByteCount()
+	 */
+	public final boolean setEchoCancellation(boolean useEchoCancellation, int newEchoTimeout)
+	{
+		configurationLock.lock();
+		try
+		{
+			echoCancellation = useEchoCancellation;
+			echoTimeout = Math.max(newEchoTimeout, 0);
+
+			if (portHandle != 0)
+			{
+				if (safetySleepTimeMS > 0)
+					try { Thread.sleep(safetySleepTimeMS); } catch (Exception e) { Thread.currentThread().interrupt(); }
+				return (androidPort != null) ? androidPort.configPort(this) : configPort(portHandle);
+			}
+			return true;
+		}
+		finally { configurationLock.unlock(); }
+	}
+
+	/**
+	 * Returns whether half-duplex echo cancellation has been enabled for this port.
+	 *
+	 * @return Whether the echo of transmitted data is removed from the received data.
+	 * @see #setEchoCancellation(boolean, int)
+	 */
+	public final boolean isEchoCancellationEnabled() { return echoCancellation; }
+
 	/**
 	 * Sets custom XON/XOFF flow control characters for the device.
 	 * <p>
@@ -1849,6 +2628,50 @@ public class SerialPort
 		finally { configurationLock.unlock(); }
 	}
 
+	/**
+	 * Sets the latency vs. throughput profile to be used by the underlying device driver.
+	 * <p>
+	 * Valid latency profiles are:
+	 * <p>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LATENCY_PROFILE_DEFAULT}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LATENCY_PROFILE_LOW_LATENCY}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LATENCY_PROFILE_BALANCED}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LATENCY_PROFILE_THROUGHPUT}
+	 * <p>
+	 * On Linux, the selected profile toggles the driver's <i>ASYNC_LOW_LATENCY</i> flag and, for USB-serial adapters that expose it
+	 * (such as FTDI devices), updates the <i>latency_timer</i> sysfs attribute to 1 ms, 4 ms, or 16 ms, respectively. The default
+	 * profile enables low-latency mode without touching the adapter's latency timer. Writing the latency timer usually requires
+	 * elevated permissions; the values that were actually achieved can be queried using {@link #getLatencyTimer()} and
+	 * {@link #isLowLatencyEnabled()} after the port has been opened.
+	 * <p>
+	 * The profile also determines the maximum chunk size used by the event-based data listeners when reading from the device.
+	 * <p>
+	 * Please note that this setting is only effective on Linux.
+	 *
+	 * @param newLatencyProfile The requested latency profile.
+	 * @return Whether the port configuration is valid or disallowed on this system (only meaningful after the port is already opened).
+	 * @see SerialPort#LATENCY_PROFILE_DEFAULT
+	 * @see SerialPort#LATENCY_PROFILE_LOW_LATENCY
+	 * @see SerialPort#LATENCY_PROFILE_BALANCED
+	 * @see SerialPort#LATENCY_PROFILE_THROUGHPUT
+	 */
+	public final boolean setLatencyProfile(int newLatencyProfile)
+	{
+		configurationLock.lock();
+		try
+		{
+			latencyProfile = newLatencyProfile;
+			if (portHandle != 0)
+			{
+				if (safetySleepTimeMS > 0)
+					try { Thread.sleep(safetySleepTimeMS); } catch (Exception e) { Thread.currentThread().interrupt(); }
+				return (androidPort != null) ? androidPort.configPort(this) : configPort(portHandle);
+			}
+			return true;
+		}
+		finally { configurationLock.unlock(); }
+	}
+
 	/**
 	 * Gets a descriptive string representing this serial port or the device connected to it.
 	 * <p>
@@ -2050,18 +2873,90 @@ public class SerialPort
 	 */
 	public final int getFlowControlSettings() { return flowControl; }
 
+	/**
+	 * Returns the currently configured latency profile for this serial port.
+	 *
+	 * @return The currently configured latency profile.
+	 * @see SerialPort#LATENCY_PROFILE_DEFAULT
+	 * @see SerialPort#LATENCY_PROFILE_LOW_LATENCY
+	 * @see SerialPort#LATENCY_PROFILE_BALANCED
+	 * @see SerialPort#LATENCY_PROFILE_THROUGHPUT
+	 */
+	public final int getLatencyProfile() { return latencyProfile; }
+
+	/**
+	 * Returns the USB-serial adapter latency timer in milliseconds as reported by the device driver.
+	 * <p>
+	 * This value is only updated when the port is opened or reconfigured, and it will be -1 if the underlying device does not
+	 * expose a latency timer or if the current operating system does not support querying it.
+	 *
+	 * @return The achieved device latency timer in milliseconds, or -1 if unavailable.
+	 */
+	public final int getLatencyTimer() { return latencyTimer; }
+
+	/**
+	 * Returns whether the device driver reports that its low-latency mode is currently enabled.
+	 * <p>
+	 * This value is only updated when the port is opened or reconfigured, and it is only meaningful on Linux.
+	 *
+	 * @return Whether low-latency mode is enabled in the underlying device driver.
+	 */
+	public final boolean isLowLatencyEnabled() { return isLowLatencyEnabled; }
+
 	// Private EventListener class
 	private final class SerialPortEventListener
 	{
-		private final boolean messageEndIsDelimited;
-		private final byte[] dataPacket, delimiters;
-		private final ByteArrayOutputStream messageBytes = new ByteArrayOutputStream();
-		private int dataPacketIndex = 0, delimiterIndex = 0;
+		private volatile SerialPortDataFramer[] dataFramers = new SerialPortDataFramer[0];
+		private byte[] readBuffer = new byte[0];
+		private long dispatchedCollisionTimestamp = 0;
 		private Thread serialEventThread = null;
 
-		public SerialPortEventListener() { dataPacket = new byte[0]; delimiters = new byte[0]; messageEndIsDelimited = true; }
-		public SerialPortEventListener(int packetSizeToReceive) { dataPacket = new byte[packetSizeToReceive]; delimiters = new byte[0]; messageEndIsDelimited = true; }
-		public SerialPortEventListener(byte[] messageDelimiters, boolean delimiterForMessageEnd) { dataPacket = new byte[0]; delimiters = messageDelimiters; messageEndIsDelimited = delimiterForMessageEnd; }
+		public final synchronized boolean addDataFramer(SerialPortDataListener listener, Executor executor)
+		{
+			// Data framers are replaced rather than modified so that the event thread can iterate over them without locking
+			for (SerialPortDataFramer dataFramer : dataFramers)
+				if (dataFramer.dataListener == listener)
+					return false;
+			SerialPortDataFramer[] newDataFramers = Arrays.copyOf(dataFramers, dataFramers.length + 1);
+			newDataFramers[dataFramers.length] = new SerialPortDataFramer(listener, executor);
+			dataFramers = newDataFramers;
+			return true;
+		}
+
+		public final synchronized boolean removeDataFramer(SerialPortDataListener listener)
+		{
+			for (int i = 0; i < dataFramers.length; ++i)
+				if (dataFramers[i].dataListener == listener)
+				{
+					dataFramers[i].failTransactions("The response matcher was removed from the serial port");
+					SerialPortDataFramer[] newDataFramers = new SerialPortDataFramer[dataFramers.length - 1];
+					System.arraycopy(dataFramers, 0, newDataFramers, 0, i);
+					System.arraycopy(dataFramers, i + 1, newDataFramers, i, newDataFramers.length - i);
+					dataFramers = newDataFramers;
+					return true;
+				}
+			return false;
+		}
+
+		public final int getNumDataFramers() { return dataFramers.length; }
+
+		public final SerialPortDataFramer getDataFramer(SerialPortDataListener listener)
+		{
+			for (SerialPortDataFramer dataFramer : dataFramers)
+				if (dataFramer.dataListener == listener)
+					return dataFramer;
+			return null;
+		}
+
+		public final int getListeningEvents()
+		{
+			int listeningEvents = 0;
+			for (SerialPortDataFramer dataFramer : dataFramers)
+				listeningEvents |= dataFramer.getListeningEvents();
+			if ((listeningEvents & SerialPort.LISTENING_EVENT_DATA_RECEIVED) > 0)
+				listeningEvents |= SerialPort.LISTENING_EVENT_DATA_AVAILABLE;
+			return listeningEvents;
+		}
 
 		public final void startListening()
 		{
@@ -2085,11 +2980,10 @@ public class SerialPort
 						try { waitForSerialEvent(); }
 						catch (Exception e)
 						{
+							// Failures outside of a listener callback leave the port in an unknown state, so stop listening and notify every listener
 							eventListenerRunning = false;
-							if (userDataListener instanceof SerialPortDataListenerWithExceptions)
-								((SerialPortDataListenerWithExceptions)userDataListener).catchException(e);
-							else if (userDataListener instanceof SerialPortMessageListenerWithExceptions)
-								((SerialPortMessageListenerWithExceptions)userDataListener).catchException(e);
+							for (SerialPortDataFramer dataFramer : dataFramers)
+								notifyListenerException(dataFramer.dataListener, e);
 						}
 					}
 					if (androidPort != null)
@@ -2136,6 +3030,8 @@ public class SerialPort
 			}
 			catch (InterruptedException e) { Thread.currentThread().interrupt(); }
 			serialEventThread = null;
+			for (SerialPortDataFramer dataFramer : dataFramers)
+				dataFramer.failTransactions("The serial port stopped listening for responses");
 
 			// Reset the previously specified timeouts and event flags
 			timeoutMode = oldTimeoutMode;
@@ -2148,84 +3044,778 @@ public class SerialPort
 
 		public final void resetBuffers()
 		{
-			messageBytes.reset();
-			delimiterIndex = dataPacketIndex = 0;
+			for (SerialPortDataFramer dataFramer : dataFramers)
+				dataFramer.reset();
+		}
+
+		private void closeIdleGapFrames(SerialPortDataFramer[] framers) throws Exception
+		{
+			// Calculate the duration of a single character at the current serial port settings
+			double characterTimeNanos = getCharacterTimeNanos();
+
+			// Close pending idle-gap frames in order of increasing gap length for as long as the line remains silent
+			long idleNanos = 0, idleStartTimestamp = System.nanoTime();
+			while (eventListenerRunning)
+			{
+				long nextIdleGap = Long.MAX_VALUE;
+				for (SerialPortDataFramer dataFramer : framers)
+					if (dataFramer.hasPendingIdleGapFrame())
+						nextIdleGap = Math.min(nextIdleGap, dataFramer.getIdleGapNanos(characterTimeNanos));
+				if (nextIdleGap == Long.MAX_VALUE)
+					return;
+				else if ((nextIdleGap > idleNanos) && !awaitIdleGap(nextIdleGap, idleStartTimestamp))
+				{
+					// Leave any newly received data for the next event, but keep waiting after a spurious wakeup
+					if (bytesAvailable() != 0)
+						return;
+					continue;
+				}
+				idleNanos = Math.max(idleNanos, nextIdleGap);
+				long readTimestamp = (androidPort != null) ? System.nanoTime() : getLastReadTimestamp(portHandle);
+				for (SerialPortDataFramer dataFramer : framers)
+					if (dataFramer.hasPendingIdleGapFrame() && (dataFramer.getIdleGapNanos(characterTimeNanos) <= idleNanos))
+					{
+						try { dataFramer.closeIdleGapFrame(readTimestamp); }
+						catch (Exception e) { reportListenerException(dataFramer.dataListener, e); }
+					}
+			}
+		}
+
+		private boolean awaitIdleGap(long idleGapNanos, long idleStartTimestamp) throws InterruptedException
+		{
+			// Native waits measure the gap from the moment the most recent data was read, while Android ports are polled from the start of the silence
+			if (androidPort == null)
+				return waitForIdleGap(portHandle, idleGapNanos);
+			long deadline = idleStartTimestamp + idleGapNanos;
+			while (eventListenerRunning && (androidPort.bytesAvailable() == 0))
+			{
+				long remainingNanos = deadline - System.nanoTime();
+				if (remainingNanos <= 0)
+					return true;
+				Thread.sleep(0, (int)Math.min(remainingNanos, 500000));
+			}
+			return false;
+		}
+
+		private int getReadChunkSize()
+		{
+			// Limit the number of bytes consumed per read according to the requested latency profile
+			switch (latencyProfile)
+			{
+				case SerialPort.LATENCY_PROFILE_LOW_LATENCY:
+					return 64;
+				case SerialPort.LATENCY_PROFILE_BALANCED:
+					return 512;
+				case SerialPort.LATENCY_PROFILE_THROUGHPUT:
+					return Math.max(receiveDeviceQueueSize, 4096);
+				default:
+					return Integer.MAX_VALUE;
+			}
 		}
 
 		public final void waitForSerialEvent() throws Exception
 		{
+			SerialPortDataFramer[] framers = dataFramers;
 			int event = ((androidPort != null) ? androidPort.waitForEvent() : waitForEvent(portHandle)) & eventFlags;
 			if (((event & SerialPort.LISTENING_EVENT_DATA_AVAILABLE) > 0) && ((eventFlags & SerialPort.LISTENING_EVENT_DATA_RECEIVED) > 0))
 			{
-				// Read data from serial port
-				int numBytesAvailable, bytesRemaining, newBytesIndex;
+				// Read data from serial port directly into the data framing buffer of a single listener, or into a shared buffer for multiple listeners
+				int numBytesAvailable, numBytesRead;
 				event &= ~(SerialPort.LISTENING_EVENT_DATA_AVAILABLE | SerialPort.LISTENING_EVENT_DATA_RECEIVED);
 				while (eventListenerRunning && ((numBytesAvailable = bytesAvailable()) > 0))
 				{
-					newBytesIndex = 0;
-					byte[] newBytes = new byte[numBytesAvailable];
-					bytesRemaining = readBytes(newBytes, newBytes.length);
-					if (bytesRemaining > 0)
+					int bytesToRead = Math.min(numBytesAvailable, getReadChunkSize());
+					if (framers.length == 1)
 					{
-						if (delimiters.length > 0)
+						numBytesRead = readBytes(framers[0].getReadBuffer(bytesToRead), bytesToRead, framers[0].getReadOffset());
+						if (numBytesRead > 0)
 						{
-							int startIndex = 0;
-							for (int offset = 0; offset < bytesRemaining; ++offset)
-								if (newBytes[offset] == delimiters[delimiterIndex])
-								{
-									if ((++delimiterIndex) == delimiters.length)
-									{
-										messageBytes.write(newBytes, startIndex, 1 + offset - startIndex);
-										byte[] byteArray = (messageEndIsDelimited ? messageBytes.toByteArray() : Arrays.copyOf(messageBytes.toByteArray(), messageBytes.size() - delimiters.length));
-										if ((byteArray.length > 0) && (messageEndIsDelimited || (delimiters[0] == byteArray[0])))
-											userDataListener.serialEvent(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, byteArray));
-										startIndex = offset + 1;
-										messageBytes.reset();
-										delimiterIndex = 0;
-										if (!messageEndIsDelimited)
-											messageBytes.write(delimiters, 0, delimiters.length);
-									}
-								}
-								else if (delimiterIndex != 0)
-									delimiterIndex = (newBytes[offset] == delimiters[0]) ? 1 : 0;
-							messageBytes.write(newBytes, startIndex, bytesRemaining - startIndex);
+							try { framers[0].frameData(numBytesRead, (androidPort != null) ? System.nanoTime() : getLastReadTimestamp(portHandle)); }
+							catch (Exception e) { reportListenerException(framers[0].dataListener, e); }
 						}
-						else if (dataPacket.length == 0)
-							userDataListener.serialEvent(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, newBytes.clone()));
-						else
-						{
-							while (bytesRemaining >= (dataPacket.length - dataPacketIndex))
+					}
+					else
+					{
+						if (readBuffer.length < bytesToRead)
+							readBuffer = new byte[bytesToRead];
+						numBytesRead = readBytes(readBuffer, bytesToRead);
+						long readTimestamp = (androidPort != null) ? System.nanoTime() : getLastReadTimestamp(portHandle);
+						for (int i = 0; (numBytesRead > 0) && (i < framers.length); ++i)
+							if ((framers[i].getListeningEvents() & SerialPort.LISTENING_EVENT_DATA_RECEIVED) > 0)
 							{
-								System.arraycopy(newBytes, newBytesIndex, dataPacket, dataPacketIndex, dataPacket.length - dataPacketIndex);
-								bytesRemaining -= (dataPacket.length - dataPacketIndex);
-								newBytesIndex += (dataPacket.length - dataPacketIndex);
-								dataPacketIndex = 0;
-								userDataListener.serialEvent(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, dataPacket.clone()));
+								try { framers[i].frameData(readBuffer, 0, numBytesRead, readTimestamp); }
+								catch (Exception e) { reportListenerException(framers[i].dataListener, e); }
 							}
-							if (bytesRemaining > 0)
+					}
+				}
+				closeIdleGapFrames(framers);
+
+				// Report any collisions detected by the native echo canceller while reading
+				long collisionTimestamp = lastCollisionTimestamp;
+				if (collisionTimestamp != dispatchedCollisionTimestamp)
+				{
+					dispatchedCollisionTimestamp = collisionTimestamp;
+					for (SerialPortDataFramer dataFramer : framers)
+					{
+						try { dataFramer.dispatchCollision(collisionTimestamp); }
+						catch (Exception e) { reportListenerException(dataFramer.dataListener, e); }
+					}
+				}
+			}
+			if (eventListenerRunning && !isShuttingDown && (event != SerialPort.LISTENING_EVENT_TIMED_OUT))
+			{
+				if ((event & SerialPort.LISTENING_EVENT_PORT_DISCONNECTED) > 0)
+					eventListenerRunning = false;
+				for (SerialPortDataFramer dataFramer : framers)
+				{
+					try { dataFramer.dispatchEvent(event); }
+					catch (Exception e) { reportListenerException(dataFramer.dataListener, e); }
+				}
+			}
+		}
+	}
+
+	// Private data framing class
+	private final class SerialPortDataFramer
+	{
+		private final SerialPortDataListener dataListener;
+		private final SerialPortDataBufferListener bufferListener;
+		private final SerialPortMessageBatchListener batchListener;
+		private final SerialPortPatternListener patternListener;
+		private final SerialPortPatternMatcher patternMatcher;
+		private final SerialPortEvent reusableEvent = new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED);
+		private final SerialPortReceiveQueue receiveQueue;
+		private final SerialPortCrc frameCrc;
+		private final SerialPortTransactionQueue transactionQueue;
+		private static final int FRAME_CODEC_NONE = 0, FRAME_CODEC_COBS = 1, FRAME_CODEC_SLIP = 2, FRAME_CODEC_HDLC = 3;
+		private final boolean messageEndIsDelimited, deliversData, frameCrcBigEndian;
+		private final byte[] delimiters, syncWord;
+		private final int packetSize, listeningEvents, frameCodec, hdlcAccm, hdlcFcsBits;
+		private byte[] dataBuffer = new byte[0];
+		private final int[] delimiterOffsets = new int[64], syncWordOffset = new int[1], patternMatcherState = new int[2], patternMatches;
+		private final int[] frameFormat, frameBounds, framerState = new int[4];
+		private final double idleGapCharacterTimes;
+		private boolean packetSyncLost = false, idleGapElapsed = false;
+		private int[] batchOffsets = new int[16], batchLengths = new int[16];
+		private int messageLength = 0, delimiterSearchOffset = 0, batchSize = 0;
+		private long messageStartTimestamp = 0, batchStartTimestamp = 0, streamOffset = 0;
+
+		public SerialPortDataFramer(SerialPortDataListener listener, Executor executor)
+		{
+			dataListener = listener;
+			receiveQueue = (executor != null) ? new SerialPortReceiveQueue(executor, listener) : null;
+			transactionQueue = (listener instanceof SerialPortResponseMatcher) ? new SerialPortTransactionQueue(SerialPort.this, (SerialPortResponseMatcher)listener) : null;
+			bufferListener = (listener instanceof SerialPortDataBufferListener) ? (SerialPortDataBufferListener)listener : null;
+			batchListener = (listener instanceof SerialPortMessageBatchListener) ? (SerialPortMessageBatchListener)listener : null;
+			patternListener = (listener instanceof SerialPortPatternListener) ? (SerialPortPatternListener)listener : null;
+			patternMatcher = (patternListener != null) ? new SerialPortPatternMatcher(patternListener.getPatterns()) : null;
+			patternMatches = new int[(patternMatcher != null) ? (2 * (64 + patternMatcher.getMaxMatchesPerByte())) : 0];
+			deliversData = ((listener.getListeningEvents() & SerialPort.LISTENING_EVENT_DATA_RECEIVED) > 0) || (transactionQueue != null);
+			listeningEvents = listener.getListeningEvents() | (((patternListener != null) || (transactionQueue != null)) ? SerialPort.LISTENING_EVENT_DATA_RECEIVED : 0);
+			packetSize = (listener instanceof SerialPortPacketListener) ? ((SerialPortPacketListener)listener).getPacketSize() : 0;
+			if ((packetSize == 0) && (listener instanceof SerialPortLengthFieldListener))
+			{
+				SerialPortLengthFieldListener lengthFieldListener = (SerialPortLengthFieldListener)listener;
+				int maximumFrameSize = (lengthFieldListener.getMaximumFrameSize() > 0) ? lengthFieldListener.getMaximumFrameSize() : Integer.MAX_VALUE;
+				frameFormat = new int[] { Math.max(lengthFieldListener.getLengthFieldOffset(), 0), Math.min(Math.max(lengthFieldListener.getLengthFieldSize(), 1), 4),
+						lengthFieldListener.isLengthFieldBigEndian() ? 1 : 0, lengthFieldListener.getLengthAdjustment(), maximumFrameSize };
+				frameBounds = new int[128];
+				syncWord = lengthFieldListener.getFrameSyncWord().clone();
+			}
+			else
+			{
+				byte[] packetSyncWord = ((packetSize > 0) && (listener instanceof SerialPortSyncPacketListener)) ? ((SerialPortSyncPacketListener)listener).getPacketSyncWord() : new byte[0];
+				syncWord = Arrays.copyOf(packetSyncWord, Math.min(packetSize, packetSyncWord.length));
+				frameFormat = frameBounds = null;
+			}
+			idleGapCharacterTimes = ((packetSize == 0) && (frameFormat == null) && (listener instanceof SerialPortIdleGapListener)) ? Math.max(((SerialPortIdleGapListener)listener).getIdleGapCharacterTimes(), 0.0) : 0.0;
+			boolean isDelimited = (packetSize == 0) && (frameFormat == null) && (idleGapCharacterTimes == 0.0);
+			if (isDelimited && (listener instanceof SerialPortCobsListener))
+				frameCodec = FRAME_CODEC_COBS;
+			else if (isDelimited && (listener instanceof SerialPortSlipListener))
+				frameCodec = FRAME_CODEC_SLIP;
+			else
+				frameCodec = (isDelimited && (listener instanceof SerialPortHdlcListener)) ? FRAME_CODEC_HDLC : FRAME_CODEC_NONE;
+			hdlcAccm = (frameCodec == FRAME_CODEC_HDLC) ? ((SerialPortHdlcListener)listener).getReceiveAccm() : 0;
+			hdlcFcsBits = (frameCodec == FRAME_CODEC_HDLC) ? ((SerialPortHdlcListener)listener).getFrameCheckSequenceBits() : 0;
+			if (frameCodec != FRAME_CODEC_NONE)
+				delimiters = new byte[] { (byte)((frameCodec == FRAME_CODEC_COBS) ? 0x00 : ((frameCodec == FRAME_CODEC_SLIP) ? 0xC0 : 0x7E)) };
+			else
+				delimiters = (isDelimited && (listener instanceof SerialPortMessageListener)) ? ((SerialPortMessageListener)listener).getMessageDelimiter() : new byte[0];
+			messageEndIsDelimited = (delimiters.length == 0) || (frameCodec != FRAME_CODEC_NONE) || ((SerialPortMessageListener)listener).delimiterIndicatesEndOfMessage();
+			boolean isFramed = (packetSize > 0) || (frameFormat != null) || (idleGapCharacterTimes > 0.0) || (delimiters.length > 0);
+			frameCrc = (isFramed && (listener instanceof SerialPortFrameCrcListener)) ? ((SerialPortFrameCrcListener)listener).getFrameCrc() : null;
+			frameCrcBigEndian = (frameCrc != null) && ((SerialPortFrameCrcListener)listener).isFrameCrcBigEndian();
+		}
+
+		public final void reset()
+		{
+			messageLength = delimiterSearchOffset = batchSize = patternMatcherState[0] = 0;
+			messageStartTimestamp = streamOffset = 0;
+			packetSyncLost = false;
+			framerState[2] = 0;
+		}
+
+		public final int getListeningEvents() { return listeningEvents; }
+
+		public final void failTransactions(String reason)
+		{
+			if (transactionQueue != null)
+				transactionQueue.failTransactions(reason);
+		}
+
+		public final int getReadOffset() { return messageLength; }
+
+		public final boolean hasPendingIdleGapFrame() { return (idleGapCharacterTimes > 0.0) && (messageLength > 0); }
+
+		public final long getIdleGapNanos(double characterTimeNanos) { return Math.max((long)(idleGapCharacterTimes * characterTimeNanos), 1L); }
+
+		public final void closeIdleGapFrame(long readTimestamp)
+		{
+			// Deliver all data received since the previous idle gap as a single frame
+			idleGapElapsed = true;
+			try { frameData(dataBuffer, 0, messageLength, messageLength, readTimestamp); }
+			finally { idleGapElapsed = false; }
+		}
+
+		public final byte[] getReadBuffer(int bytesToRead)
+		{
+			// Any partially received message is kept at the start of the buffer so that every complete message is contiguous
+			if (dataBuffer.length < (messageLength + bytesToRead))
+				dataBuffer = Arrays.copyOf(dataBuffer, Math.max(messageLength + bytesToRead, 2 * dataBuffer.length));
+			return dataBuffer;
+		}
+
+		public final void frameData(int numBytesRead, long readTimestamp) { frameData(dataBuffer, 0, messageLength + numBytesRead, messageLength, readTimestamp); }
+
+		public final void frameData(byte[] data, int offset, int length, long readTimestamp)
+		{
+			// Frame directly from a shared buffer unless a partial message must first be completed in the private buffer or frames must be decoded in place
+			if ((messageLength == 0) && (frameCodec == FRAME_CODEC_NONE))
+				frameData(data, offset, offset + length, offset, readTimestamp);
+			else
+			{
+				System.arraycopy(data, offset, getReadBuffer(length), messageLength, length);
+				frameData(length, readTimestamp);
+			}
+		}
+
+		private void frameData(byte[] buffer, int startIndex, int endIndex, int newDataIndex, long readTimestamp)
+		{
+			// Report any pattern matches in the new data, then frame all complete messages or packets contained in the buffer
+			if (patternMatcher != null)
+				matchPatterns(buffer, newDataIndex, endIndex, readTimestamp);
+			if ((messageStartTimestamp == 0) || ((packetSize > 0) && (newDataIndex == startIndex)))
+				messageStartTimestamp = readTimestamp;
+			if (!deliversData)
+				startIndex = endIndex;
+			else if (frameFormat != null)
+			{
+				// Parse all complete length-prefixed frames natively, resynchronizing on any corrupt frame headers
+				int numFrames = frameBounds.length / 2;
+				while (numFrames == (frameBounds.length / 2))
+				{
+					numFrames = findLengthFieldFrames(buffer, startIndex, endIndex, syncWord, frameFormat, framerState, frameBounds);
+					for (int i = 0; i < numFrames; ++i)
+					{
+						dispatchData(buffer, frameBounds[2 * i], frameBounds[(2 * i) + 1], messageStartTimestamp, readTimestamp);
+						messageStartTimestamp = readTimestamp;
+					}
+					if (framerState[1] > 0)
+						messageStartTimestamp = readTimestamp;
+					startIndex = framerState[0];
+					packetSyncDiscardedBytes += framerState[1];
+					packetSyncLossCount += framerState[3];
+				}
+			}
+			else if (idleGapCharacterTimes > 0.0)
+			{
+				// Idle-gap frames remain pending until the line has been silent for the required number of character times
+				if (idleGapElapsed && (endIndex > startIndex))
+				{
+					dispatchData(buffer, startIndex, endIndex - startIndex, messageStartTimestamp, readTimestamp);
+					messageStartTimestamp = 0;
+					startIndex = endIndex;
+				}
+			}
+			else if (delimiters.length > 0)
+			{
+				// Locate delimiters natively, rescanning only the tail of the pending message in case a delimiter spans multiple reads
+				int numDelimiters = delimiterOffsets.length, searchIndex = Math.max(newDataIndex + 1 - delimiters.length, startIndex + delimiterSearchOffset);
+				while (numDelimiters == delimiterOffsets.length)
+				{
+					numDelimiters = findDelimiters(buffer, searchIndex, endIndex, delimiters, delimiterOffsets);
+					for (int i = 0; i < numDelimiters; ++i)
+					{
+						int delimiterEnd = delimiterOffsets[i] + delimiters.length;
+						int messageSize = (messageEndIsDelimited ? delimiterEnd : delimiterOffsets[i]) - startIndex;
+						if ((frameCodec != FRAME_CODEC_NONE) && (messageSize > 1))
+						{
+							// Decode COBS, SLIP, or HDLC frames in place, excluding their delimiters
+							int decodedSize;
+							if (frameCodec == FRAME_CODEC_COBS)
+								decodedSize = decodeCobs(buffer, startIndex, messageSize - 1);
+							else if (frameCodec == FRAME_CODEC_SLIP)
+								decodedSize = decodeSlip(buffer, startIndex, messageSize - 1);
+							else
+								decodedSize = decodeHdlc(buffer, startIndex, messageSize - 1, hdlcAccm, hdlcFcsBits);
+							if (decodedSize >= 0)
+								dispatchData(buffer, startIndex, decodedSize, messageStartTimestamp, readTimestamp);
+							else
 							{
-								System.arraycopy(newBytes, newBytesIndex, dataPacket, dataPacketIndex, bytesRemaining);
-								dataPacketIndex += bytesRemaining;
+								++framingErrorCount;
+								if (decodedSize == -2)
+									++checksumErrorCount;
+								else if (frameCodec != FRAME_CODEC_COBS)
+									++malformedEscapeCount;
 							}
 						}
+						else if ((frameCodec == FRAME_CODEC_NONE) && (messageSize > 0) && (messageEndIsDelimited || (delimiters[0] == buffer[startIndex])))
+							dispatchData(buffer, startIndex, messageSize, messageStartTimestamp, readTimestamp);
+						messageStartTimestamp = (!messageEndIsDelimited || (delimiterEnd < endIndex)) ? readTimestamp : 0;
+						startIndex = messageEndIsDelimited ? delimiterEnd : delimiterOffsets[i];
+						delimiterSearchOffset = messageEndIsDelimited ? 0 : delimiters.length;
+						searchIndex = delimiterEnd;
 					}
 				}
 			}
-			if (eventListenerRunning && !isShuttingDown && (event != SerialPort.LISTENING_EVENT_TIMED_OUT))
+			else if (packetSize == 0)
 			{
-				// If disconnected, invoke the user data listener from a new thread to allow them to close the port without blocking
-				if ((event & SerialPort.LISTENING_EVENT_PORT_DISCONNECTED) > 0)
+				dispatchData(buffer, startIndex, endIndex - startIndex, readTimestamp, readTimestamp);
+				startIndex = endIndex;
+			}
+			else
+				while ((endIndex - startIndex) >= ((syncWord.length > 0) ? syncWord.length : packetSize))
 				{
-					eventListenerRunning = false;
-					SerialPortThreadFactory.get().newThread(new Runnable() {
-						@Override
-						public void run() { userDataListener.serialEvent(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_PORT_DISCONNECTED)); }
-					}).start();
+					if ((syncWord.length > 0) && !startsWithSyncWord(buffer, startIndex))
+					{
+						// Natively search for the next synchronization word, keeping any partial synchronization word at the end of the buffer
+						int discardEnd = (findDelimiters(buffer, startIndex + 1, endIndex, syncWord, syncWordOffset) > 0) ? syncWordOffset[0] : Math.max(startIndex + 1, endIndex + 1 - syncWord.length);
+						if (!packetSyncLost)
+							++packetSyncLossCount;
+						packetSyncLost = true;
+						packetSyncDiscardedBytes += discardEnd - startIndex;
+						messageStartTimestamp = readTimestamp;
+						startIndex = discardEnd;
+					}
+					else if ((endIndex - startIndex) < packetSize)
+						break;
+					else
+					{
+						packetSyncLost = false;
+						dispatchData(buffer, startIndex, packetSize, messageStartTimestamp, readTimestamp);
+						messageStartTimestamp = readTimestamp;
+						startIndex += packetSize;
+					}
+				}
+
+			// Deliver any batched messages before moving the remaining partial message to the start of the private buffer
+			if (batchSize > 0)
+			{
+				int numMessages = batchSize;
+				batchSize = 0;
+				if (receiveQueue != null)
+				{
+					// Queue a private copy of the batch, since the internal buffers will be reused by the next read
+					int batchStart = batchOffsets[0], batchEnd = batchOffsets[numMessages - 1] + batchLengths[numMessages - 1];
+					int[] offsets = new int[numMessages];
+					for (int i = 0; i < numMessages; ++i)
+						offsets[i] = batchOffsets[i] - batchStart;
+					receiveQueue.enqueueData(new SerialPortDataCallback(dataListener, null, Arrays.copyOfRange(buffer, batchStart, batchEnd), offsets,
+							Arrays.copyOf(batchLengths, numMessages), true, batchStartTimestamp, readTimestamp));
 				}
 				else
-					userDataListener.serialEvent(new SerialPortEvent(SerialPort.this, event));
+				{
+					reusableEvent.setTimestamps(batchStartTimestamp, readTimestamp);
+					batchListener.serialMessagesReceived(reusableEvent, buffer, batchOffsets, batchLengths, numMessages);
+				}
 			}
+			messageLength = endIndex - startIndex;
+			if ((maximumMessageSize > 0) && (messageLength > maximumMessageSize))
+			{
+				// Discard any partial message that has grown beyond the maximum allowable message size
+				receiveQueueDroppedBytes += messageLength;
+				++discardedMessageCount;
+				messageLength = delimiterSearchOffset = 0;
+				messageStartTimestamp = 0;
+			}
+			else if (buffer != dataBuffer)
+			{
+				if (dataBuffer.length < messageLength)
+					dataBuffer = new byte[Math.max(messageLength, 2 * dataBuffer.length)];
+				System.arraycopy(buffer, startIndex, dataBuffer, 0, messageLength);
+			}
+			else if ((startIndex > 0) && (messageLength > 0))
+				System.arraycopy(dataBuffer, startIndex, dataBuffer, 0, messageLength);
 		}
+
+		private boolean startsWithSyncWord(byte[] buffer, int offset)
+		{
+			for (int i = 0; i < syncWord.length; ++i)
+				if (buffer[offset + i] != syncWord[i])
+					return false;
+			return true;
+		}
+
+		private void matchPatterns(byte[] buffer, int startIndex, int endIndex, long readTimestamp)
+		{
+			// Scan the new data natively, continuing from the automaton state left by the previous read so that matches may span reads
+			long readStreamOffset = streamOffset - startIndex;
+			streamOffset += endIndex - startIndex;
+			while (startIndex < endIndex)
+			{
+				int numMatches = findPatterns(patternMatcher.getAutomaton(), buffer, startIndex, endIndex, patternMatcher.getMaxMatchesPerByte(), patternMatcherState, patternMatches);
+				startIndex = patternMatcherState[1];
+				for (int i = 0; i < numMatches; ++i)
+				{
+					final int patternId = patternMatches[2 * i];
+					final long matchOffset = readStreamOffset + patternMatches[(2 * i) + 1] - patternMatcher.getPatternLength(patternId);
+					if (receiveQueue != null)
+					{
+						final SerialPortEvent matchEvent = new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, null, readTimestamp, readTimestamp);
+						receiveQueue.execute(new Runnable() {
+							@Override
+							public void run() { patternListener.patternMatched(matchEvent, patternId, matchOffset); }
+						});
+					}
+					else
+					{
+						reusableEvent.setTimestamps(readTimestamp, readTimestamp);
+						patternListener.patternMatched(reusableEvent, patternId, matchOffset);
+					}
+				}
+			}
+		}
+
+		private void dispatchData(byte[] buffer, int offset, int length, long firstByteTimestamp, long lastByteTimestamp)
+		{
+			// Verify the trailing CRC of each frame in place so that corrupt frames are never copied or delivered
+			if ((frameCrc != null) && !frameCrc.verify(buffer, offset, length, frameCrcBigEndian))
+			{
+				++checksumErrorCount;
+				++framingErrorCount;
+				return;
+			}
+
+			// Frames that complete an outstanding transaction are consumed by that transaction instead of being delivered to the listener
+			if ((transactionQueue != null) && transactionQueue.completeTransaction(buffer, offset, length, lastByteTimestamp))
+				return;
+
+			// Batch listeners receive all messages from a single read at once, buffer listeners receive a view into the internal
+			//   buffer, and all other listeners receive a private copy of the data
+			if (batchListener != null)
+			{
+				if (batchSize == batchOffsets.length)
+				{
+					batchOffsets = Arrays.copyOf(batchOffsets, 2 * batchSize);
+					batchLengths = Arrays.copyOf(batchLengths, 2 * batchSize);
+				}
+				if (batchSize == 0)
+					batchStartTimestamp = firstByteTimestamp;
+				batchOffsets[batchSize] = offset;
+				batchLengths[batchSize++] = length;
+			}
+			else if (receiveQueue != null)
+			{
+				// Queue a private copy of the data, which may be coalesced with other queued data if it is not framed into messages
+				SerialPortBufferPool bufferPool = eventBufferPool;
+				if ((bufferPool != null) && (bufferListener == null))
+					receiveQueue.enqueueData(new SerialPortDataCallback(dataListener, bufferPool.createEvent(SerialPort.this, buffer, offset, length, firstByteTimestamp, lastByteTimestamp),
+							null, null, null, false, firstByteTimestamp, lastByteTimestamp));
+				else
+					receiveQueue.enqueueData(new SerialPortDataCallback(dataListener, null, Arrays.copyOfRange(buffer, offset, offset + length), null, null,
+							(packetSize == 0) && (frameFormat == null) && (idleGapCharacterTimes == 0.0) && (delimiters.length == 0), firstByteTimestamp, lastByteTimestamp));
+			}
+			else if (bufferListener != null)
+			{
+				reusableEvent.setTimestamps(firstByteTimestamp, lastByteTimestamp);
+				bufferListener.serialDataReceived(reusableEvent, buffer, offset, length);
+			}
+			else
+			{
+				SerialPortBufferPool bufferPool = eventBufferPool;
+				dataListener.serialEvent((bufferPool != null) ? bufferPool.createEvent(SerialPort.this, buffer, offset, length, firstByteTimestamp, lastByteTimestamp) :
+					new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, Arrays.copyOfRange(buffer, offset, offset + length), firstByteTimestamp, lastByteTimestamp));
+			}
+		}
+
+		public final void dispatchEvent(int event)
+		{
+			// If disconnected, invoke the user data listener from a new thread to allow them to close the port without blocking
+			if ((event & listeningEvents) == 0)
+				return;
+			else if ((event & SerialPort.LISTENING_EVENT_PORT_DISCONNECTED) > 0)
+			{
+				Runnable disconnectCallback = new Runnable() {
+					@Override
+					public void run() { dataListener.serialEvent(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_PORT_DISCONNECTED)); }
+				};
+				if (receiveQueue != null)
+					receiveQueue.execute(disconnectCallback);
+				else
+					SerialPortThreadFactory.get().newThread(disconnectCallback).start();
+			}
+			else if (receiveQueue != null)
+			{
+				final SerialPortEvent serialEvent = new SerialPortEvent(SerialPort.this, event & listeningEvents);
+				receiveQueue.execute(new Runnable() {
+					@Override
+					public void run() { dataListener.serialEvent(serialEvent); }
+				});
+			}
+			else
+				dataListener.serialEvent(new SerialPortEvent(SerialPort.this, event & listeningEvents));
+		}
+
+		public final void dispatchCollision(long timestampNanos)
+		{
+			// Collisions are detected while reading, so report them with the time at which the colliding data arrived
+			if ((listeningEvents & SerialPort.LISTENING_EVENT_COLLISION) == 0)
+				return;
+			final SerialPortEvent serialEvent = new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_COLLISION, null, timestampNanos, timestampNanos);
+			if (receiveQueue != null)
+				receiveQueue.execute(new Runnable() {
+					@Override
+					public void run() { dataListener.serialEvent(serialEvent); }
+				});
+			else
+				dataListener.serialEvent(serialEvent);
+		}
+	}
+
+	// Private class describing a queued data callback
+	private final class SerialPortDataCallback implements Runnable
+	{
+		private final SerialPortDataListener dataListener;
+		private final SerialPortEvent pooledEvent;
+		private final boolean isCoalescable;
+		private byte[] data;
+		private int[] offsets, lengths;
+		private long firstByteTimestamp, lastByteTimestamp;
+
+		public SerialPortDataCallback(SerialPortDataListener listener, SerialPortEvent event, byte[] eventData, int[] messageOffsets, int[] messageLengths,
+				boolean canCoalesce, long firstByteTimestampNanos, long lastByteTimestampNanos)
+		{
+			dataListener = listener;
+			pooledEvent = event;
+			data = eventData;
+			offsets = messageOffsets;
+			lengths = messageLengths;
+			isCoalescable = canCoalesce;
+			firstByteTimestamp = firstByteTimestampNanos;
+			lastByteTimestamp = lastByteTimestampNanos;
+		}
+
+		public final int getDataLength() { return (pooledEvent != null) ? pooledEvent.getReceivedData().length : data.length; }
+
+		public final void discard()
+		{
+			if (pooledEvent != null)
+				pooledEvent.release();
+		}
+
+		public final boolean coalesce(SerialPortDataCallback newerCallback)
+		{
+			// Append the data and any message boundaries from the newer callback to this one
+			if (!isCoalescable || !newerCallback.isCoalescable)
+				return false;
+			int originalLength = data.length;
+			data = Arrays.copyOf(data, originalLength + newerCallback.data.length);
+			System.arraycopy(newerCallback.data, 0, data, originalLength, newerCallback.data.length);
+			if (offsets != null)
+			{
+				int originalMessages = offsets.length;
+				offsets = Arrays.copyOf(offsets, originalMessages + newerCallback.offsets.length);
+				lengths = Arrays.copyOf(lengths, originalMessages + newerCallback.lengths.length);
+				for (int i = 0; i < newerCallback.offsets.length; ++i)
+				{
+					offsets[originalMessages + i] = originalLength + newerCallback.offsets[i];
+					lengths[originalMessages + i] = newerCallback.lengths[i];
+				}
+			}
+			lastByteTimestamp = newerCallback.lastByteTimestamp;
+			return true;
+		}
+
+		@Override
+		public void run()
+		{
+			if (offsets != null)
+				((SerialPortMessageBatchListener)dataListener).serialMessagesReceived(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, null, firstByteTimestamp, lastByteTimestamp), data, offsets, lengths, offsets.length);
+			else if (dataListener instanceof SerialPortDataBufferListener)
+				((SerialPortDataBufferListener)dataListener).serialDataReceived(new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, null, firstByteTimestamp, lastByteTimestamp), data, 0, data.length);
+			else
+				dataListener.serialEvent((pooledEvent != null) ? pooledEvent : new SerialPortEvent(SerialPort.this, SerialPort.LISTENING_EVENT_DATA_RECEIVED, data, firstByteTimestamp, lastByteTimestamp));
+		}
+	}
+
+	// Private class that queues listener callbacks and invokes them on a user-supplied Executor one at a time and in order
+	private final class SerialPortReceiveQueue implements Runnable
+	{
+		private static final int MAX_CALLBACKS_PER_TASK = 64;
+		private final Executor userExecutor;
+		private final SerialPortDataListener dataListener;
+		private final ArrayDeque<Runnable> pendingCallbacks = new ArrayDeque<Runnable>();
+		private final ReentrantLock queueLock = new ReentrantLock();
+		private final Condition queueNotFull = queueLock.newCondition();
+		private int numQueuedDataCallbacks = 0;
+		private boolean isScheduled = false;
+
+		public SerialPortReceiveQueue(Executor executor, SerialPortDataListener listener) { userExecutor = executor; dataListener = listener; }
+
+		public final void execute(Runnable callback)
+		{
+			// Callbacks for non-data events are never dropped or delayed
+			queueLock.lock();
+			try
+			{
+				pendingCallbacks.offer(callback);
+				receiveQueueHighWaterMark = Math.max(receiveQueueHighWaterMark, pendingCallbacks.size());
+			}
+			finally { queueLock.unlock(); }
+			schedule();
+		}
+
+		public final void enqueueData(SerialPortDataCallback callback)
+		{
+			queueLock.lock();
+			try
+			{
+				// Apply the overflow policy while the maximum number of data callbacks are pending
+				while ((receiveQueueCapacity > 0) && (numQueuedDataCallbacks >= receiveQueueCapacity) && eventListenerRunning)
+				{
+					Runnable newestCallback = pendingCallbacks.peekLast();
+					if (receiveQueuePolicy == SerialPort.RECEIVE_QUEUE_DROP_NEWEST)
+					{
+						dropCallback(callback);
+						return;
+					}
+					else if (receiveQueuePolicy == SerialPort.RECEIVE_QUEUE_DROP_OLDEST)
+					{
+						for (Iterator<Runnable> iterator = pendingCallbacks.iterator(); iterator.hasNext(); )
+						{
+							Runnable pendingCallback = iterator.next();
+							if (pendingCallback instanceof SerialPortDataCallback)
+							{
+								iterator.remove();
+								--numQueuedDataCallbacks;
+								dropCallback((SerialPortDataCallback)pendingCallback);
+								break;
+							}
+						}
+					}
+					else if ((receiveQueuePolicy == SerialPort.RECEIVE_QUEUE_COALESCE) && (newestCallback instanceof SerialPortDataCallback) &&
+							((SerialPortDataCallback)newestCallback).coalesce(callback))
+					{
+						++receiveQueueCoalescedEvents;
+						return;
+					}
+					else
+					{
+						// Stop reading until a callback completes, allowing device flow control to throttle the incoming data
+						try { queueNotFull.await(100, TimeUnit.MILLISECONDS); }
+						catch (InterruptedException e) { Thread.currentThread().interrupt(); break; }
+					}
+				}
+				pendingCallbacks.offer(callback);
+				++numQueuedDataCallbacks;
+				receiveQueueHighWaterMark = Math.max(receiveQueueHighWaterMark, pendingCallbacks.size());
+			}
+			finally { queueLock.unlock(); }
+			schedule();
+		}
+
+		@Override
+		public void run()
+		{
+			// Return the executor thread after a limited number of callbacks so that ports sharing an executor are serviced fairly
+			for (int i = 0; i < MAX_CALLBACKS_PER_TASK; ++i)
+			{
+				Runnable callback;
+				queueLock.lock();
+				try
+				{
+					if ((callback = pendingCallbacks.poll()) == null)
+					{
+						isScheduled = false;
+						return;
+					}
+					if (callback instanceof SerialPortDataCallback)
+					{
+						--numQueuedDataCallbacks;
+						queueNotFull.signal();
+					}
+				}
+				finally { queueLock.unlock(); }
+				try { callback.run(); }
+				catch (Exception e) { reportListenerException(dataListener, e); }
+			}
+			queueLock.lock();
+			try { isScheduled = false; }
+			finally { queueLock.unlock(); }
+			schedule();
+		}
+
+		private void dropCallback(SerialPortDataCallback callback)
+		{
+			++receiveQueueDroppedEvents;
+			receiveQueueDroppedBytes += callback.getDataLength();
+			callback.discard();
+		}
+
+		private void schedule()
+		{
+			queueLock.lock();
+			try
+			{
+				if (isScheduled || pendingCallbacks.isEmpty())
+					return;
+				isScheduled = true;
+			}
+			finally { queueLock.unlock(); }
+			try { userExecutor.execute(this); }
+			catch (RuntimeException e)
+			{
+				queueLock.lock();
+				try { isScheduled = false; }
+				finally { queueLock.unlock(); }
+				throw e;
+			}
+		}
+	}
+
+	// Removes a listener whose callback threw an exception, leaving any other registered listeners unaffected, and forwards the exception to it
+	private void reportListenerException(SerialPortDataListener listener, Exception e)
+	{
+		// Remove the listener exactly as removeDataListener(listener) would, unless another thread holding the configuration lock is already stopping the event thread
+		boolean isLocked = false;
+		try
+		{
+			while (!(isLocked = configurationLock.tryLock(10, TimeUnit.MILLISECONDS)) && eventListenerRunning)
+				continue;
+		}
+		catch (InterruptedException ignored) { Thread.currentThread().interrupt(); }
+		if (isLocked)
+		{
+			try { removeDataListener(listener); }
+			finally { configurationLock.unlock(); }
+		}
+		else
+		{
+			SerialPortEventListener eventListener = serialEventListener;
+			if (eventListener != null)
+				eventListener.removeDataFramer(listener);
+		}
+		notifyListenerException(listener, e);
+	}
+
+	// Forwards an exception thrown during event processing to a listener that accepts exceptions
+	private void notifyListenerException(SerialPortDataListener listener, Exception e)
+	{
+		if (listener instanceof SerialPortDataListenerWithExceptions)
+			((SerialPortDataListenerWithExceptions)listener).catchException(e);
+		else if (listener instanceof SerialPortMessageListenerWithExceptions)
+			((SerialPortMessageListenerWithExceptions)listener).catchException(e);
 	}
 
 	// InputStream interface class
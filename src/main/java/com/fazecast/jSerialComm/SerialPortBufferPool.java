@@ -0,0 +1,263 @@
+/*
+ * SerialPortBufferPool.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.util.Collections;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+
+/**
+ * This class implements a pool of recyclable byte arrays used to hold the data contained in received {@link SerialPortEvent}s.
+ * <p>
+ * When a buffer pool is registered with a serial port using {@link SerialPort#setEventBufferPool(SerialPortBufferPool)}, the array returned
+ * by {@link SerialPortEvent#getReceivedData()} will be taken from this pool instead of being newly allocated. Applications should call
+ * {@link SerialPortEvent#release()} once they no longer need the received data so that its array can be reused for a later event.
+ * <p>
+ * Arrays are pooled according to their exact length so that {@link SerialPortEvent#getReceivedData()} continues to return an array
+ * containing only the received bytes. This makes pooling most effective for {@link SerialPortPacketListener}s and for messages of a
+ * small number of distinct sizes. Once more distinct sizes have been seen than the pool can track, the least recently used size is
+ * evicted along with any of its idle buffers.
+ * <p>
+ * If leak detection is enabled, either by using the {@link #SerialPortBufferPool(boolean)} constructor or by setting the
+ * "jSerialComm.bufferPool.leakDetection" system property to "true", the allocation site of every event that is garbage collected
+ * without having been released will be printed to the standard error stream.
+ *
+ * @see SerialPort#setEventBufferPool(SerialPortBufferPool)
+ * @see SerialPortEvent#release()
+ */
+public final class SerialPortBufferPool
+{
+	// Pool size limits
+	static private final int MAX_SIZE_CLASSES = 32, MAX_BUFFERS_PER_SIZE_CLASS = 64;
+
+	// Pooled buffers and usage metrics
+	private final AtomicReferenceArray<SizeClass> sizeClasses = new AtomicReferenceArray<SizeClass>(MAX_SIZE_CLASSES);
+	private final AtomicLong requestCount = new AtomicLong(), hitCount = new AtomicLong(), releaseCount = new AtomicLong(), leakCount = new AtomicLong();
+	private final AtomicLong sizeClassUseCount = new AtomicLong();
+	private final boolean leakDetectionEnabled;
+	private final ReferenceQueue<SerialPortEvent> leakedEvents = new ReferenceQueue<SerialPortEvent>();
+	private final Set<LeakTracker> trackedEvents = Collections.newSetFromMap(new ConcurrentHashMap<LeakTracker, Boolean>());
+
+	/**
+	 * Constructs a new buffer pool with leak detection enabled only if the "jSerialComm.bufferPool.leakDetection" system property is set to "true".
+	 */
+	public SerialPortBufferPool() { this(System.getProperty("jSerialComm.bufferPool.leakDetection", "false").equalsIgnoreCase("true")); }
+
+	/**
+	 * Constructs a new buffer pool with the specified leak detection setting.
+	 * <p>
+	 * Leak detection records the call stack for every pooled buffer that is handed out, so it should only be enabled while debugging.
+	 *
+	 * @param enableLeakDetection Whether to report events that are garbage collected without having been released.
+	 */
+	public SerialPortBufferPool(boolean enableLeakDetection) { leakDetectionEnabled = enableLeakDetection; }
+
+	/**
+	 * Returns the total number of buffers that have been requested from this pool.
+	 *
+	 * @return The number of buffer requests.
+	 */
+	public final long getRequestCount() { return requestCount.get(); }
+
+	/**
+	 * Returns the number of buffer requests that were satisfied by a previously released buffer.
+	 *
+	 * @return The number of buffer requests that did not require a new allocation.
+	 */
+	public final long getHitCount() { return hitCount.get(); }
+
+	/**
+	 * Returns the fraction of buffer requests that were satisfied by a previously released buffer.
+	 *
+	 * @return The pool hit rate between 0.0 and 1.0, or 0.0 if no buffers have been requested.
+	 */
+	public final double getHitRate()
+	{
+		long requests = requestCount.get();
+		return (requests == 0) ? 0.0 : ((double)hitCount.get() / (double)requests);
+	}
+
+	/**
+	 * Returns the total number of buffers that have been returned to this pool using {@link SerialPortEvent#release()}.
+	 *
+	 * @return The number of released buffers.
+	 */
+	public final long getReleaseCount() { return releaseCount.get(); }
+
+	/**
+	 * Returns the number of events that were garbage collected without having been released.
+	 * <p>
+	 * This value is only maintained when leak detection is enabled.
+	 *
+	 * @return The number of detected buffer leaks.
+	 */
+	public final long getLeakCount()
+	{
+		detectLeaks();
+		return leakCount.get();
+	}
+
+	/**
+	 * Returns whether leak detection is enabled for this pool.
+	 *
+	 * @return Whether leak detection is enabled.
+	 */
+	public final boolean isLeakDetectionEnabled() { return leakDetectionEnabled; }
+
+	/**
+	 * Returns the number of buffers currently available for reuse in this pool.
+	 *
+	 * @return The number of idle pooled buffers.
+	 */
+	public final int getPooledBufferCount()
+	{
+		int pooledBuffers = 0;
+		for (int i = 0; i < MAX_SIZE_CLASSES; ++i)
+		{
+			SizeClass sizeClass = sizeClasses.get(i);
+			if (sizeClass != null)
+				pooledBuffers += sizeClass.numBuffers.get();
+		}
+		return pooledBuffers;
+	}
+
+	// Creates a new data event whose payload is copied into a pooled buffer
+	final SerialPortEvent createEvent(SerialPort comPort, byte[] data, int offset, int length, long firstByteTimestampNanos, long lastByteTimestampNanos)
+	{
+		// Reuse a previously released buffer of the same size if one is available
+		byte[] buffer = null;
+		SizeClass sizeClass = getSizeClass(length, false);
+		requestCount.incrementAndGet();
+		if ((sizeClass != null) && ((buffer = sizeClass.buffers.poll()) != null))
+		{
+			sizeClass.numBuffers.decrementAndGet();
+			hitCount.incrementAndGet();
+		}
+		else
+			buffer = new byte[length];
+		System.arraycopy(data, offset, buffer, 0, length);
+
+		// Track the event if leak detection is enabled
+		SerialPortEvent event = new SerialPortEvent(comPort, SerialPort.LISTENING_EVENT_DATA_RECEIVED, buffer, firstByteTimestampNanos, lastByteTimestampNanos);
+		LeakTracker leakTracker = null;
+		if (leakDetectionEnabled)
+		{
+			detectLeaks();
+			leakTracker = new LeakTracker(event, leakedEvents);
+			trackedEvents.add(leakTracker);
+		}
+		event.setBufferPool(this, leakTracker);
+		return event;
+	}
+
+	// Returns the buffer belonging to a released event to the pool
+	final void releaseBuffer(byte[] buffer, LeakTracker leakTracker)
+	{
+		releaseCount.incrementAndGet();
+		if (leakTracker != null)
+		{
+			trackedEvents.remove(leakTracker);
+			leakTracker.clear();
+		}
+		SizeClass sizeClass = getSizeClass(buffer.length, true);
+		if ((sizeClass != null) && (sizeClass.numBuffers.incrementAndGet() <= MAX_BUFFERS_PER_SIZE_CLASS))
+			sizeClass.buffers.offer(buffer);
+		else if (sizeClass != null)
+			sizeClass.numBuffers.decrementAndGet();
+	}
+
+	private SizeClass getSizeClass(int length, boolean createIfMissing)
+	{
+		// Size classes are only ever replaced, never removed, so a linear scan up to the first empty slot finds any existing class
+		int leastRecentlyUsedIndex = 0;
+		SizeClass leastRecentlyUsed = null;
+		for (int i = 0; i < MAX_SIZE_CLASSES; ++i)
+		{
+			SizeClass sizeClass = sizeClasses.get(i);
+			if (sizeClass == null)
+			{
+				if (!createIfMissing)
+					return null;
+				sizeClasses.compareAndSet(i, null, new SizeClass(length));
+				sizeClass = sizeClasses.get(i);
+			}
+			if (sizeClass.length == length)
+			{
+				sizeClass.lastUsed = sizeClassUseCount.incrementAndGet();
+				return sizeClass;
+			}
+			if ((leastRecentlyUsed == null) || (sizeClass.lastUsed < leastRecentlyUsed.lastUsed))
+			{
+				leastRecentlyUsedIndex = i;
+				leastRecentlyUsed = sizeClass;
+			}
+		}
+
+		// Recycle the least recently used slot for the new length, discarding any of its idle buffers
+		if (!createIfMissing)
+			return null;
+		SizeClass sizeClass = new SizeClass(length);
+		sizeClass.lastUsed = sizeClassUseCount.incrementAndGet();
+		return sizeClasses.compareAndSet(leastRecentlyUsedIndex, leastRecentlyUsed, sizeClass) ? sizeClass : null;
+	}
+
+	private void detectLeaks()
+	{
+		Reference<? extends SerialPortEvent> leakedEvent;
+		while ((leakedEvent = leakedEvents.poll()) != null)
+			if (trackedEvents.remove(leakedEvent))
+			{
+				leakCount.incrementAndGet();
+				((LeakTracker)leakedEvent).allocationSite.printStackTrace();
+			}
+	}
+
+	// Private class containing all idle buffers of a single length
+	private static final class SizeClass
+	{
+		private final int length;
+		private final ConcurrentLinkedQueue<byte[]> buffers = new ConcurrentLinkedQueue<byte[]>();
+		private final AtomicInteger numBuffers = new AtomicInteger();
+		private volatile long lastUsed = 0;
+
+		public SizeClass(int bufferLength) { length = bufferLength; }
+	}
+
+	// Package-private class recording where a pooled event was created
+	static final class LeakTracker extends PhantomReference<SerialPortEvent>
+	{
+		private final Throwable allocationSite = new Throwable("jSerialComm: A pooled SerialPortEvent was garbage collected without calling release(). It was created at:");
+
+		public LeakTracker(SerialPortEvent event, ReferenceQueue<SerialPortEvent> queue) { super(event, queue); }
+	}
+}
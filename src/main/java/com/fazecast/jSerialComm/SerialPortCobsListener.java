@@ -0,0 +1,43 @@
+/*
+ * SerialPortCobsListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to enable event-based reads of frames encoded using Consistent Overhead Byte Stuffing (COBS).
+ * <p>
+ * Received data is split into frames at each zero byte, and every frame is decoded in native code before its payload is delivered to the
+ * {@link #serialEvent(SerialPortEvent)} callback. Empty frames are ignored, and any frame that is not valid COBS is discarded and counted by
+ * {@link SerialPort#getFramingErrorCount()}. This interface may be combined with the {@link SerialPortDataBufferListener} or
+ * {@link SerialPortMessageBatchListener} interfaces to receive decoded payloads without per-frame memory allocations.
+ * <p>
+ * Frames may be sent in the same encoding using {@link SerialPort#writeCobsFrame(byte[], int, int)}.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortCobsListener extends SerialPortDataListener {}
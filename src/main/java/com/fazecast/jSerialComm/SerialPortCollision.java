@@ -0,0 +1,99 @@
+/*
+ * SerialPortCollision.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class describes a single half-duplex bus collision detected by the native echo canceller.
+ * <p>
+ * A collision is recorded whenever a byte received in place of the echo of a transmitted byte does not match the byte that was transmitted,
+ * indicating that another device was driving the bus at the same time.
+ *
+ * @see SerialPort#setEchoCancellation(boolean, int)
+ * @see SerialPort#readCollisions()
+ */
+public final class SerialPortCollision
+{
+	private final SerialPort serialPort;
+	private final byte expectedByte, receivedByte;
+	private final long timestamp;
+
+	/**
+	 * Constructs a {@link SerialPortCollision} object describing a mismatch between a transmitted byte and its echo.
+	 *
+	 * @param comPort The {@link SerialPort} on which the collision occurred.
+	 * @param expected The byte that was transmitted.
+	 * @param received The byte that was received in place of its echo.
+	 * @param timestampNanos The monotonic time in nanoseconds at which the colliding data was received.
+	 */
+	public SerialPortCollision(SerialPort comPort, byte expected, byte received, long timestampNanos)
+	{
+		serialPort = comPort;
+		expectedByte = expected;
+		receivedByte = received;
+		timestamp = timestampNanos;
+	}
+
+	/**
+	 * Returns the {@link SerialPort} on which this collision occurred.
+	 *
+	 * @return The {@link SerialPort} on which this collision occurred.
+	 */
+	public final SerialPort getSerialPort() { return serialPort; }
+
+	/**
+	 * Returns the transmitted byte whose echo was expected.
+	 *
+	 * @return The byte that was transmitted.
+	 */
+	public final byte getExpectedByte() { return expectedByte; }
+
+	/**
+	 * Returns the byte that was actually received in place of the echo.
+	 *
+	 * @return The byte that was received.
+	 */
+	public final byte getReceivedByte() { return receivedByte; }
+
+	/**
+	 * Returns the time at which the colliding data was received.
+	 * <p>
+	 * Timestamps are expressed in nanoseconds using the same monotonic time source as {@link SerialPortEvent#getTimestampNanos()}.
+	 *
+	 * @return The monotonic time in nanoseconds at which the colliding data was received.
+	 */
+	public final long getTimestampNanos() { return timestamp; }
+
+	/**
+	 * Returns a string representation of this collision.
+	 *
+	 * @return A string representation of this collision.
+	 */
+	@Override
+	public final String toString()
+	{
+		return String.format("Expected 0x%02X but received 0x%02X at %d", expectedByte & 0xFF, receivedByte & 0xFF, timestamp);
+	}
+}
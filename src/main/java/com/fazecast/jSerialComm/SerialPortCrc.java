@@ -0,0 +1,335 @@
+/*
+ * SerialPortCrc.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.nio.ByteBuffer;
+
+/**
+ * This class implements a native cyclic redundancy check (CRC) engine for arbitrary CRC algorithms of up to 32 bits.
+ * <p>
+ * Each CRC algorithm is described using the parameters of the Rocksoft model: its width, polynomial, initial value, whether input bytes and the
+ * final result are reflected, and the value with which the final result is XORed. The lookup tables for an algorithm are generated once when a
+ * {@code SerialPortCrc} is constructed, after which all CRC calculations are carried out in native code using the slice-by-8 technique.
+ * <p>
+ * Instances of this class are immutable and may be shared between threads. The most commonly used algorithms are available as predefined constants.
+ *
+ * @see SerialPortFrameCrcListener
+ */
+public final class SerialPortCrc
+{
+	/**
+	 * CRC-16/MODBUS: width=16, poly=0x8005, init=0xFFFF, refin=true, refout=true, xorout=0x0000, check=0x4B37.
+	 */
+	static final public SerialPortCrc CRC16_MODBUS = new SerialPortCrc(16, 0x8005, 0xFFFF, true, true, 0x0000);
+
+	/**
+	 * CRC-16/CCITT-FALSE (also known as CRC-16/IBM-3740): width=16, poly=0x1021, init=0xFFFF, refin=false, refout=false, xorout=0x0000, check=0x29B1.
+	 */
+	static final public SerialPortCrc CRC16_CCITT_FALSE = new SerialPortCrc(16, 0x1021, 0xFFFF, false, false, 0x0000);
+
+	/**
+	 * CRC-16/KERMIT (also known as CRC-16/CCITT): width=16, poly=0x1021, init=0x0000, refin=true, refout=true, xorout=0x0000, check=0x2189.
+	 */
+	static final public SerialPortCrc CRC16_KERMIT = new SerialPortCrc(16, 0x1021, 0x0000, true, true, 0x0000);
+
+	/**
+	 * CRC-16/XMODEM: width=16, poly=0x1021, init=0x0000, refin=false, refout=false, xorout=0x0000, check=0x31C3.
+	 */
+	static final public SerialPortCrc CRC16_XMODEM = new SerialPortCrc(16, 0x1021, 0x0000, false, false, 0x0000);
+
+	/**
+	 * CRC-16/X-25 (the HDLC 16-bit FCS): width=16, poly=0x1021, init=0xFFFF, refin=true, refout=true, xorout=0xFFFF, check=0x906E.
+	 */
+	static final public SerialPortCrc CRC16_X25 = new SerialPortCrc(16, 0x1021, 0xFFFF, true, true, 0xFFFF);
+
+	/**
+	 * CRC-32 (also known as CRC-32/ISO-HDLC): width=32, poly=0x04C11DB7, init=0xFFFFFFFF, refin=true, refout=true, xorout=0xFFFFFFFF, check=0xCBF43926.
+	 */
+	static final public SerialPortCrc CRC32 = new SerialPortCrc(32, 0x04C11DB7L, 0xFFFFFFFFL, true, true, 0xFFFFFFFFL);
+
+	/**
+	 * CRC-32C (also known as CRC-32/ISCSI or Castagnoli): width=32, poly=0x1EDC6F41, init=0xFFFFFFFF, refin=true, refout=true, xorout=0xFFFFFFFF, check=0xE3069283.
+	 */
+	static final public SerialPortCrc CRC32C = new SerialPortCrc(32, 0x1EDC6F41L, 0xFFFFFFFFL, true, true, 0xFFFFFFFFL);
+
+	// Algorithm parameters and slice-by-8 lookup tables
+	private final int width, initialRegister;
+	private final long polynomial, initialValue, finalXorValue, mask;
+	private final boolean reflectInput, reflectOutput;
+	private final int[] tables = new int[2048];
+
+	/**
+	 * Constructs a new CRC engine using the specified Rocksoft model parameters.
+	 *
+	 * @param width The width of the CRC in bits, between 1 and 32.
+	 * @param polynomial The generator polynomial in normal (non-reflected) form, excluding its most significant bit.
+	 * @param initialValue The initial value of the CRC register in normal (non-reflected) form.
+	 * @param reflectInput Whether each input byte is processed least significant bit first.
+	 * @param reflectOutput Whether the final CRC register value is reflected before the final XOR is applied.
+	 * @param finalXorValue The value with which the final CRC is XORed.
+	 * @throws IllegalArgumentException If the CRC width is not between 1 and 32.
+	 */
+	public SerialPortCrc(int width, long polynomial, long initialValue, boolean reflectInput, boolean reflectOutput, long finalXorValue) throws IllegalArgumentException
+	{
+		if ((width < 1) || (width > 32))
+			throw new IllegalArgumentException("CRC width must be between 1 and 32 bits");
+		this.width = width;
+		this.reflectInput = reflectInput;
+		this.reflectOutput = reflectOutput;
+		mask = (width == 32) ? 0xFFFFFFFFL : ((1L << width) - 1);
+		this.polynomial = polynomial & mask;
+		this.initialValue = initialValue & mask;
+		this.finalXorValue = finalXorValue & mask;
+
+		// Generate the first lookup table for processing a single byte, with the CRC register right-aligned if reflected or left-aligned otherwise
+		if (reflectInput)
+		{
+			int reflectedPolynomial = (int)reflect(this.polynomial, width);
+			for (int i = 0; i < 256; ++i)
+			{
+				int crc = i;
+				for (int bit = 0; bit < 8; ++bit)
+					crc = ((crc & 1) != 0) ? ((crc >>> 1) ^ reflectedPolynomial) : (crc >>> 1);
+				tables[i] = crc;
+			}
+			for (int k = 1; k < 8; ++k)
+				for (int i = 0; i < 256; ++i)
+					tables[(256 * k) + i] = (tables[(256 * (k - 1)) + i] >>> 8) ^ tables[tables[(256 * (k - 1)) + i] & 0xFF];
+		}
+		else
+		{
+			int alignedPolynomial = (int)(this.polynomial << (32 - width));
+			for (int i = 0; i < 256; ++i)
+			{
+				int crc = i << 24;
+				for (int bit = 0; bit < 8; ++bit)
+					crc = (crc < 0) ? ((crc << 1) ^ alignedPolynomial) : (crc << 1);
+				tables[i] = crc;
+			}
+			for (int k = 1; k < 8; ++k)
+				for (int i = 0; i < 256; ++i)
+					tables[(256 * k) + i] = (tables[(256 * (k - 1)) + i] << 8) ^ tables[tables[(256 * (k - 1)) + i] >>> 24];
+		}
+		initialRegister = toRegister(reflectInput ? reflect(this.initialValue, width) : this.initialValue);
+	}
+
+	/**
+	 * Returns the width of this CRC in bits.
+	 *
+	 * @return The CRC width.
+	 */
+	public final int getWidth() { return width; }
+
+	/**
+	 * Returns the number of bytes required to transmit this CRC.
+	 *
+	 * @return The CRC width rounded up to a whole number of bytes.
+	 */
+	public final int getByteLength() { return (width + 7) / 8; }
+
+	/**
+	 * Returns the generator polynomial of this CRC in normal (non-reflected) form.
+	 *
+	 * @return The CRC polynomial.
+	 */
+	public final long getPolynomial() { return polynomial; }
+
+	/**
+	 * Returns the initial value of this CRC in normal (non-reflected) form.
+	 *
+	 * @return The initial CRC value.
+	 */
+	public final long getInitialValue() { return initialValue; }
+
+	/**
+	 * Returns whether input bytes are processed least significant bit first.
+	 *
+	 * @return Whether input bytes are reflected.
+	 */
+	public final boolean isInputReflected() { return reflectInput; }
+
+	/**
+	 * Returns whether the final CRC register value is reflected before the final XOR is applied.
+	 *
+	 * @return Whether the CRC output is reflected.
+	 */
+	public final boolean isOutputReflected() { return reflectOutput; }
+
+	/**
+	 * Returns the value with which the final CRC is XORed.
+	 *
+	 * @return The final XOR value.
+	 */
+	public final long getFinalXorValue() { return finalXorValue; }
+
+	/**
+	 * Calculates the CRC of the specified bytes.
+	 *
+	 * @param data The buffer containing the data.
+	 * @param offset The index of the first byte to include.
+	 * @param length The number of bytes to include.
+	 * @return The calculated CRC value.
+	 * @throws IndexOutOfBoundsException If the offset or length is negative, or if the specified range extends past the end of the buffer.
+	 */
+	public final long calculate(byte[] data, int offset, int length) throws IndexOutOfBoundsException
+	{
+		checkRange(data, offset, length);
+		return fromRegister(SerialPort.updateCrc(tables, reflectInput, initialRegister, data, offset, length));
+	}
+
+	/**
+	 * Calculates the CRC of all bytes in the specified array.
+	 *
+	 * @param data The data for which to calculate the CRC.
+	 * @return The calculated CRC value.
+	 */
+	public final long calculate(byte[] data) { return calculate(data, 0, data.length); }
+
+	/**
+	 * Calculates the CRC of all bytes between the current position and the limit of the specified buffer.
+	 * <p>
+	 * The position of the buffer is not changed. Direct buffers are processed in place without being copied.
+	 *
+	 * @param data The buffer containing the data.
+	 * @return The calculated CRC value.
+	 */
+	public final long calculate(ByteBuffer data) { return update(fromRegister(initialRegister), data); }
+
+	/**
+	 * Continues a CRC calculation with additional data.
+	 * <p>
+	 * Calling this method with the CRC of a previous block of data returns the CRC of that block followed by the specified bytes, so that the CRC of data
+	 * that arrives in multiple pieces can be calculated incrementally.
+	 *
+	 * @param crc The CRC value of all preceding data.
+	 * @param data The buffer containing the additional data.
+	 * @param offset The index of the first byte to include.
+	 * @param length The number of bytes to include.
+	 * @return The CRC value of the preceding data followed by the additional data.
+	 * @throws IndexOutOfBoundsException If the offset or length is negative, or if the specified range extends past the end of the buffer.
+	 */
+	public final long update(long crc, byte[] data, int offset, int length) throws IndexOutOfBoundsException
+	{
+		checkRange(data, offset, length);
+		return fromRegister(SerialPort.updateCrc(tables, reflectInput, toRegister(unfinalize(crc)), data, offset, length));
+	}
+
+	/**
+	 * Continues a CRC calculation with all bytes between the current position and the limit of the specified buffer.
+	 * <p>
+	 * The position of the buffer is not changed. Direct buffers are processed in place without being copied.
+	 *
+	 * @param crc The CRC value of all preceding data.
+	 * @param data The buffer containing the additional data.
+	 * @return The CRC value of the preceding data followed by the additional data.
+	 */
+	public final long update(long crc, ByteBuffer data)
+	{
+		if (data.hasArray())
+			return update(crc, data.array(), data.arrayOffset() + data.position(), data.remaining());
+		else if (data.isDirect())
+			return fromRegister(SerialPort.updateCrcDirect(tables, reflectInput, toRegister(unfinalize(crc)), data, data.position(), data.remaining()));
+		byte[] copy = new byte[data.remaining()];
+		data.duplicate().get(copy);
+		return update(crc, copy, 0, copy.length);
+	}
+
+	/**
+	 * Verifies a frame whose final {@link #getByteLength()} bytes contain the CRC of all preceding bytes in the frame.
+	 *
+	 * @param frame The buffer containing the frame.
+	 * @param offset The index of the first byte of the frame.
+	 * @param length The total length of the frame, including its CRC.
+	 * @param crcIsBigEndian Whether the CRC is stored most significant byte first.
+	 * @return Whether the frame is long enough to contain a CRC and its stored CRC matches the calculated one.
+	 * @throws IndexOutOfBoundsException If the offset or length is negative, or if the specified frame extends past the end of the buffer.
+	 */
+	public final boolean verify(byte[] frame, int offset, int length, boolean crcIsBigEndian) throws IndexOutOfBoundsException
+	{
+		int crcLength = getByteLength();
+		checkRange(frame, offset, length);
+		if (length < crcLength)
+			return false;
+		long storedCrc = 0;
+		for (int i = 0; i < crcLength; ++i)
+			storedCrc |= (long)(frame[offset + length - crcLength + i] & 0xFF) << (8 * (crcIsBigEndian ? (crcLength - 1 - i) : i));
+		return storedCrc == calculate(frame, offset, length - crcLength);
+	}
+
+	/**
+	 * Calculates the CRC of the specified bytes and stores it immediately after them in the same buffer.
+	 * <p>
+	 * The buffer must have room for {@link #getByteLength()} additional bytes following the data.
+	 *
+	 * @param frame The buffer containing the data.
+	 * @param offset The index of the first byte to include.
+	 * @param length The number of bytes to include.
+	 * @param crcIsBigEndian Whether to store the CRC most significant byte first.
+	 * @return The total length of the frame including its appended CRC.
+	 * @throws IndexOutOfBoundsException If the offset or length is negative, or if the buffer has no room for the CRC following the data.
+	 */
+	public final int append(byte[] frame, int offset, int length, boolean crcIsBigEndian) throws IndexOutOfBoundsException
+	{
+		int crcLength = getByteLength();
+		checkRange(frame, offset, length);
+		checkRange(frame, offset, length + crcLength);
+		long crc = calculate(frame, offset, length);
+		for (int i = 0; i < crcLength; ++i)
+			frame[offset + length + i] = (byte)(crc >>> (8 * (crcIsBigEndian ? (crcLength - 1 - i) : i)));
+		return length + crcLength;
+	}
+
+	private static void checkRange(byte[] data, int offset, int length) throws IndexOutOfBoundsException
+	{
+		if ((length < 0) || (offset < 0) || (length > (data.length - offset)))
+			throw new IndexOutOfBoundsException("The specified offset plus length extends past the end of the specified buffer.");
+	}
+
+	private int toRegister(long value) { return reflectInput ? (int)value : (int)(value << (32 - width)); }
+
+	private long fromRegister(int register)
+	{
+		long value = reflectInput ? (register & mask) : ((register >>> (32 - width)) & mask);
+		if (reflectInput != reflectOutput)
+			value = reflect(value, width);
+		return (value ^ finalXorValue) & mask;
+	}
+
+	private long unfinalize(long crc)
+	{
+		long value = (crc ^ finalXorValue) & mask;
+		return (reflectInput != reflectOutput) ? reflect(value, width) : value;
+	}
+
+	private static long reflect(long value, int numBits)
+	{
+		long reflected = 0;
+		for (int bit = 0; bit < numBits; ++bit)
+			if ((value & (1L << bit)) != 0)
+				reflected |= 1L << (numBits - 1 - bit);
+		return reflected;
+	}
+}
@@ -0,0 +1,59 @@
+/*
+ * SerialPortDataBufferListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to receive event-based serial port data without any per-event memory allocations.
+ * <p>
+ * Instead of creating a new {@link SerialPortEvent} containing a newly allocated copy of the received data, all received data will be passed to the
+ * {@link #serialDataReceived(SerialPortEvent, byte[], int, int)} callback as a view into an internal buffer. This interface may be combined with either
+ * the {@link SerialPortPacketListener} or the {@link SerialPortMessageListener} interface to receive full packets or delimited messages in the same manner.
+ * <p>
+ * All other serial port events will continue to be delivered via the {@link #serialEvent(SerialPortEvent)} callback.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see com.fazecast.jSerialComm.SerialPortPacketListener
+ * @see com.fazecast.jSerialComm.SerialPortMessageListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortDataBufferListener extends SerialPortDataListener
+{
+	/**
+	 * Called whenever new data has been received by the serial port, in place of the {@link #serialEvent(SerialPortEvent)} callback.
+	 * <p>
+	 * The {@code data} array is owned by the serial port and will be reused for subsequent events, so the received bytes may only be accessed for the
+	 * duration of this callback and must not be modified. Any bytes that are needed after this callback returns must be copied by the application.
+	 * <p>
+	 * The passed-in {@code event} object is likewise reused for each callback. It will always be of type {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED}
+	 * and report the timestamps of the received data, but its {@link SerialPortEvent#getReceivedData()} method will return <i>null</i>.
+	 *
+	 * @param event A reusable {@link SerialPortEvent} describing the timing of the received data.
+	 * @param data The internal buffer containing the received data.
+	 * @param offset The index of the first received byte within {@code data}.
+	 * @param length The number of received bytes.
+	 */
+	void serialDataReceived(SerialPortEvent event, byte[] data, int offset, int length);
+}
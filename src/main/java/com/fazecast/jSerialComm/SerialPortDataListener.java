@@ -52,6 +52,7 @@ public interface SerialPortDataListener extends EventListener
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_PARITY_ERROR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_COLLISION}<br>
 	 * <p>
 	 * Two or more events may be OR'd together to listen for multiple events; however, if {@link SerialPort#LISTENING_EVENT_DATA_AVAILABLE} is OR'd with
 	 * {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED}, the {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED} flag will take precedence.
@@ -59,6 +60,9 @@ public interface SerialPortDataListener extends EventListener
 	 * Note that event-based <i>write</i> callbacks are only supported on Windows operating systems. As such, the {@link SerialPort#LISTENING_EVENT_DATA_WRITTEN}
 	 * event will never be called on a non-Windows system.
 	 * <p>
+	 * The {@link SerialPort#LISTENING_EVENT_COLLISION} event is only generated when half-duplex echo cancellation has been enabled using
+	 * {@link SerialPort#setEchoCancellation(boolean, int)} and received data is being read by the event listener via {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED}.
+	 * <p>
 	 * It is recommended to <b>only</b> use the {@link SerialPort#LISTENING_EVENT_DATA_AVAILABLE}, {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED},
 	 * {@link SerialPort#LISTENING_EVENT_DATA_WRITTEN}, and/or {@link SerialPort#LISTENING_EVENT_PORT_DISCONNECTED} listening events in production or cross-platform code
 	 * since underlying differences and lack of support for the control line status and error events among the various operating systems and device drivers make it
@@ -78,6 +82,7 @@ public interface SerialPortDataListener extends EventListener
 	 * @see SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_PARITY_ERROR
+	 * @see SerialPort#LISTENING_EVENT_COLLISION
 	 */
 	int getListeningEvents();
 	
@@ -2,10 +2,10 @@
  * SerialPortEvent.java
  *
  *       Created on:  Feb 25, 2015
- *  Last Updated on:  Jun 08, 2022
+ *  Last Updated on:  Oct 18, 2026
  *           Author:  Will Hedgecock
  *
- * Copyright (C) 2012-2022 Fazecast, Inc.
+ * Copyright (C) 2012-2026 Fazecast, Inc.
  *
  * This file is part of jSerialComm.
  *
@@ -36,7 +36,10 @@ public class SerialPortEvent extends EventObject
 {
 	private static final long serialVersionUID = 3060830619653354150L;
 	private final int eventType;
-	private final byte[] serialData;
+	private byte[] serialData;
+	private long firstByteTimestamp, lastByteTimestamp;
+	private transient SerialPortBufferPool bufferPool = null;
+	private transient SerialPortBufferPool.LeakTracker bufferLeakTracker = null;
 
 	/**
 	 * Constructs a {@link SerialPortEvent} object corresponding to the specified serial event type.
@@ -58,6 +61,7 @@ public class SerialPortEvent extends EventObject
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_PARITY_ERROR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_COLLISION}<br>
 	 * <p>
 	 * Note that event-based write callbacks are only supported on Windows operating systems. As such, the {@link SerialPort#LISTENING_EVENT_DATA_WRITTEN}
 	 * event will never be called on a non-Windows system.
@@ -80,12 +84,14 @@ public class SerialPortEvent extends EventObject
 	 * @see SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_PARITY_ERROR
+	 * @see SerialPort#LISTENING_EVENT_COLLISION
 	 */
 	public SerialPortEvent(SerialPort comPort, int serialEventType)
 	{
 		super(comPort);
 		eventType = serialEventType;
 		serialData = null;
+		firstByteTimestamp = lastByteTimestamp = 0;
 	}
 	
 	/**
@@ -106,6 +112,7 @@ public class SerialPortEvent extends EventObject
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_PARITY_ERROR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_COLLISION}<br>
 	 * <p>
 	 * Note that event-based write callbacks are only supported on Windows operating systems. As such, the {@link SerialPort#LISTENING_EVENT_DATA_WRITTEN}
 	 * event will never be called on a non-Windows system.
@@ -129,12 +136,36 @@ public class SerialPortEvent extends EventObject
 	 * @see SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_PARITY_ERROR
+	 * @see SerialPort#LISTENING_EVENT_COLLISION
 	 */
 	public SerialPortEvent(SerialPort comPort, int serialEventType, byte[] data)
 	{
 		super(comPort);
 		eventType = serialEventType;
 		serialData = data;
+		firstByteTimestamp = lastByteTimestamp = 0;
+	}
+
+	/**
+	 * Constructs a {@link SerialPortEvent} object corresponding to the specified serial event type and containing the passed-in data bytes
+	 * along with the times at which the first and last of those bytes were received.
+	 * <p>
+	 * Timestamps are expressed in nanoseconds using a monotonic time source.
+	 *
+	 * @param comPort The {@link SerialPort} about which this object is being created.
+	 * @param serialEventType The type of serial port event that this object describes.
+	 * @param data The raw data bytes corresponding to this serial port event.
+	 * @param firstByteTimestampNanos The monotonic time in nanoseconds at which the first data byte was received.
+	 * @param lastByteTimestampNanos The monotonic time in nanoseconds at which the last data byte was received.
+	 * @see #SerialPortEvent(SerialPort, int, byte[])
+	 */
+	public SerialPortEvent(SerialPort comPort, int serialEventType, byte[] data, long firstByteTimestampNanos, long lastByteTimestampNanos)
+	{
+		super(comPort);
+		eventType = serialEventType;
+		serialData = data;
+		firstByteTimestamp = firstByteTimestampNanos;
+		lastByteTimestamp = lastByteTimestampNanos;
 	}
 
 	/**
@@ -158,6 +189,7 @@ public class SerialPortEvent extends EventObject
 			case SerialPort.LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR: return "LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR";
 			case SerialPort.LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR: return "LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR";
 			case SerialPort.LISTENING_EVENT_PARITY_ERROR: return "LISTENING_EVENT_PARITY_ERROR";
+			case SerialPort.LISTENING_EVENT_COLLISION: return "LISTENING_EVENT_COLLISION";
 			default: return "LISTENING_EVENT_UNKNOWN_TYPE";
 		}
 	}
@@ -187,6 +219,7 @@ public class SerialPortEvent extends EventObject
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR}<br>
 	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_PARITY_ERROR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_COLLISION}<br>
 	 * <p>
 	 * Note that event-based write callbacks are only supported on Windows operating systems. As such, the {@link SerialPort#LISTENING_EVENT_DATA_WRITTEN}
 	 * event will never be called on a non-Windows system.
@@ -208,13 +241,77 @@ public class SerialPortEvent extends EventObject
 	 * @see SerialPort#LISTENING_EVENT_FIRMWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_SOFTWARE_OVERRUN_ERROR
 	 * @see SerialPort#LISTENING_EVENT_PARITY_ERROR
+	 * @see SerialPort#LISTENING_EVENT_COLLISION
 	 */
 	public final int getEventType() { return eventType; }
 	
 	/**
 	 * Returns any raw data bytes associated with this serial port event.
+	 * <p>
+	 * If this event was created using a {@link SerialPortBufferPool}, the returned array belongs to that pool and must no longer
+	 * be accessed after {@link #release()} has been called.
 	 * 
 	 * @return Any data bytes associated with this serial port event or null if none exist.
 	 */
 	public final byte[] getReceivedData() { return serialData; }
+
+	/**
+	 * Returns the data array associated with this serial port event to the {@link SerialPortBufferPool} from which it was taken.
+	 * <p>
+	 * After calling this method, {@link #getReceivedData()} will return <i>null</i>. Calling this method more than once, or calling it on
+	 * an event that was not created using a {@link SerialPortBufferPool}, has no effect.
+	 *
+	 * @see SerialPort#setEventBufferPool(SerialPortBufferPool)
+	 */
+	public final void release()
+	{
+		SerialPortBufferPool pool = bufferPool;
+		if (pool != null)
+		{
+			bufferPool = null;
+			pool.releaseBuffer(serialData, bufferLeakTracker);
+			serialData = null;
+			bufferLeakTracker = null;
+		}
+	}
+
+	/**
+	 * Returns the time at which the data associated with this serial port event was received.
+	 * <p>
+	 * The timestamp is captured by the native library as soon as the operating system reports that data is ready to be read, before
+	 * any thread handoff or message framing takes place. For messages assembled by a {@link SerialPortMessageListener} or
+	 * {@link SerialPortPacketListener}, this is the time at which the last byte of the message was received.
+	 * <p>
+	 * Timestamps are expressed in nanoseconds using a monotonic time source, and they are only meaningful when compared to one another.
+	 * On Linux and Windows, this time source is the same one used by {@link System#nanoTime()}, so timestamps may also be compared
+	 * directly to the result of that method.
+	 *
+	 * @return The monotonic receive time in nanoseconds of the associated data, or 0 if no timestamp is available.
+	 */
+	public final long getTimestampNanos() { return lastByteTimestamp; }
+
+	/**
+	 * Returns the time at which the first byte of the data associated with this serial port event was received.
+	 * <p>
+	 * This will differ from {@link #getTimestampNanos()} only for messages that were assembled from multiple reads by a
+	 * {@link SerialPortMessageListener} or {@link SerialPortPacketListener}.
+	 *
+	 * @return The monotonic receive time in nanoseconds of the first associated data byte, or 0 if no timestamp is available.
+	 * @see #getTimestampNanos()
+	 */
+	public final long getFirstByteTimestampNanos() { return firstByteTimestamp; }
+
+	// Associates this event with the buffer pool from which its data array was taken
+	final void setBufferPool(SerialPortBufferPool pool, SerialPortBufferPool.LeakTracker leakTracker)
+	{
+		bufferPool = pool;
+		bufferLeakTracker = leakTracker;
+	}
+
+	// Updates the timestamps of a reusable event before it is passed to a SerialPortDataBufferListener
+	final void setTimestamps(long firstByteTimestampNanos, long lastByteTimestampNanos)
+	{
+		firstByteTimestamp = firstByteTimestampNanos;
+		lastByteTimestamp = lastByteTimestampNanos;
+	}
 }
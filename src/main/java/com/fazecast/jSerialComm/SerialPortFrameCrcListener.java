@@ -0,0 +1,62 @@
+/*
+ * SerialPortFrameCrcListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface may be implemented in addition to any framing listener to have the cyclic redundancy check (CRC) of each received frame verified
+ * in native code before the frame is delivered.
+ * <p>
+ * Each frame that would otherwise be delivered is expected to end with its CRC, calculated over all preceding bytes of the frame using the algorithm
+ * returned by {@link #getFrameCrc()}. Frames that pass verification are delivered intact, including their trailing CRC bytes, while frames that fail
+ * verification are discarded without being copied and are counted by both {@link SerialPort#getChecksumErrorCount()} and
+ * {@link SerialPort#getFramingErrorCount()}.
+ * <p>
+ * This interface is intended to be combined with the {@link SerialPortPacketListener}, {@link SerialPortLengthFieldListener},
+ * {@link SerialPortIdleGapListener}, {@link SerialPortCobsListener}, or {@link SerialPortSlipListener} interfaces. It has no effect on listeners
+ * that receive unframed data.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortCrc
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortFrameCrcListener extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the CRC algorithm used to verify each received frame.
+	 * <p>
+	 * This method is only called once when the listener is registered.
+	 *
+	 * @return The CRC algorithm protecting each frame, such as {@link SerialPortCrc#CRC16_MODBUS}.
+	 */
+	SerialPortCrc getFrameCrc();
+
+	/**
+	 * Must be overridden to return whether the CRC at the end of each frame is stored most significant byte first.
+	 *
+	 * @return Whether the frame CRC is big-endian.
+	 */
+	boolean isFrameCrcBigEndian();
+}
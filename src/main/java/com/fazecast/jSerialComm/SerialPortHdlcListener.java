@@ -0,0 +1,68 @@
+/*
+ * SerialPortHdlcListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to enable event-based reads of frames using asynchronous HDLC-like framing as described in RFC 1662.
+ * <p>
+ * Received data is split into frames at each flag byte (0x7E). Each frame is then processed in native code: all control characters selected by
+ * {@link #getReceiveAccm()} are removed, all control-escape sequences (0x7D) are decoded, and the frame check sequence is verified. Only the payload
+ * of each valid frame, excluding its frame check sequence, is delivered to the {@link #serialEvent(SerialPortEvent)} callback.
+ * <p>
+ * Empty frames, such as those produced by back-to-back flag bytes, are ignored. Frames with an invalid frame check sequence are discarded without being
+ * copied and are counted by both {@link SerialPort#getChecksumErrorCount()} and {@link SerialPort#getFramingErrorCount()}, and aborted frames ending in a
+ * control-escape byte are counted by both {@link SerialPort#getMalformedEscapeCount()} and {@link SerialPort#getFramingErrorCount()}. This interface
+ * may be combined with the {@link SerialPortDataBufferListener} or {@link SerialPortMessageBatchListener} interfaces to receive payloads without
+ * per-frame memory allocations.
+ * <p>
+ * Frames may be sent in the same encoding using {@link SerialPort#writeHdlcFrame(byte[], int, int, int, int)}.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortHdlcListener extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the size of the frame check sequence in bits.
+	 * <p>
+	 * Valid values are 16 for the 16-bit FCS and 32 for the 32-bit FCS defined by RFC 1662, or 0 to disable frame check sequence verification.
+	 *
+	 * @return The number of bits in the frame check sequence.
+	 */
+	int getFrameCheckSequenceBits();
+
+	/**
+	 * Must be overridden to return the receive async control character map.
+	 * <p>
+	 * Bit <i>n</i> of the returned value indicates that control character <i>n</i> (0x00-0x1F) may have been inserted by the link and must be removed
+	 * from received data. RFC 1662 specifies a default value of 0xFFFFFFFF, while links that transfer all control characters transparently use 0.
+	 *
+	 * @return The receive async control character map.
+	 */
+	int getReceiveAccm();
+}
@@ -0,0 +1,54 @@
+/*
+ * SerialPortIdleGapListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to enable event-based reads of frames that are delimited by periods of line silence, such as Modbus RTU frames.
+ * <p>
+ * All received data is accumulated until the line has been idle for the number of character times returned by {@link #getIdleGapCharacterTimes()},
+ * at which point the accumulated data is delivered to the {@link #serialEvent(SerialPortEvent)} callback as a single frame. The duration of one
+ * character time is calculated from the current baud rate, number of data bits, parity, and number of stop bits of the serial port, and the idle gap
+ * is measured in native code from the moment the most recently received byte was read.
+ * <p>
+ * Note that some USB-to-serial adapters deliver received data to the host in bursts, which may make inter-character gaps appear longer or shorter than
+ * they actually were on the line. Such adapters should be configured for their lowest possible latency when using this interface.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortIdleGapListener extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the number of character times of line silence that indicate the end of a frame.
+	 * <p>
+	 * For example, Modbus RTU uses a value of 3.5.
+	 *
+	 * @return The number of idle character times that terminate a frame.
+	 */
+	double getIdleGapCharacterTimes();
+}
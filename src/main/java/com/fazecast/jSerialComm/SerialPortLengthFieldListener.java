@@ -0,0 +1,98 @@
+/*
+ * SerialPortLengthFieldListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to enable event-based reads of frames whose length is described by a length field in the frame header.
+ * <p>
+ * Each frame may begin with an optional synchronization word, followed at a fixed offset by an unsigned length field of 1 to 4 bytes. The total
+ * size of a frame is calculated as:
+ * <p>
+ * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link #getLengthFieldOffset()} + {@link #getLengthFieldSize()} + <i>length field value</i> + {@link #getLengthAdjustment()}
+ * <p>
+ * For example, a protocol using frames of the form <code>[sync:2][length:u16le][payload][crc:2]</code>, where the length field contains the
+ * payload size, would use a length field offset of 2, a length field size of 2, little-endian byte order, and a length adjustment of 2.
+ * <p>
+ * Whenever a frame does not begin with the synchronization word or describes a total size that is smaller than its own header or larger than
+ * {@link #getMaximumFrameSize()}, received data will be discarded until the next plausible frame header so that framing is automatically
+ * resynchronized with the data stream. All frame parsing is carried out in native code, and each complete frame is delivered to the
+ * {@link #serialEvent(SerialPortEvent)} callback in the same manner as for a {@link SerialPortPacketListener}.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortLengthFieldListener extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the synchronization word with which every frame begins.
+	 * <p>
+	 * If an empty array is returned, frames will be resynchronized solely based on the plausibility of their length fields.
+	 *
+	 * @return A byte array containing the synchronization word that must be present at the start of every frame.
+	 */
+	byte[] getFrameSyncWord();
+
+	/**
+	 * Must be overridden to return the offset of the length field from the start of the frame, including any synchronization word.
+	 *
+	 * @return The byte offset of the length field within a frame.
+	 */
+	int getLengthFieldOffset();
+
+	/**
+	 * Must be overridden to return the size of the unsigned length field in bytes, which must be between 1 and 4.
+	 *
+	 * @return The number of bytes in the length field.
+	 */
+	int getLengthFieldSize();
+
+	/**
+	 * Must be overridden to return whether the length field is transmitted in big-endian or little-endian byte order.
+	 *
+	 * @return Whether the length field is big-endian.
+	 */
+	boolean isLengthFieldBigEndian();
+
+	/**
+	 * Must be overridden to return the number of bytes to add to the length field value to obtain the number of bytes that follow the length field.
+	 * <p>
+	 * This value may be negative, for example if the length field value also counts the frame header.
+	 *
+	 * @return The adjustment to apply to the length field value.
+	 */
+	int getLengthAdjustment();
+
+	/**
+	 * Must be overridden to return the maximum total size of a valid frame in bytes, including its header.
+	 * <p>
+	 * Any frame describing a larger size will be treated as corrupt and trigger resynchronization.
+	 *
+	 * @return The maximum allowable frame size.
+	 */
+	int getMaximumFrameSize();
+}
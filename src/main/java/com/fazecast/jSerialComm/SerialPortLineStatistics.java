@@ -0,0 +1,150 @@
+/*
+ * SerialPortLineStatistics.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class contains a snapshot of the cumulative data transfer and line error counters for a serial port.
+ * <p>
+ * Userspace counters are maintained by this library for every call to {@link SerialPort#readBytes(byte[], int)} and
+ * {@link SerialPort#writeBytes(byte[], int)} since the port was opened. Driver counters are maintained by the operating
+ * system for the lifetime of the device and are only available on Linux; they will be -1 when unavailable.
+ *
+ * @see SerialPort#getLineStatistics()
+ */
+public final class SerialPortLineStatistics
+{
+	private final long timestamp, bytesRead, bytesWritten, readCalls, writeCalls;
+	private final long rxCount, txCount, framingErrors, overrunErrors, parityErrors, breakCount, bufferOverrunErrors;
+	private final boolean driverCountersAvailable;
+
+	SerialPortLineStatistics(long[] counters, boolean driverCountersSupported, long timestampNanos)
+	{
+		bytesRead = counters[0];
+		bytesWritten = counters[1];
+		readCalls = counters[2];
+		writeCalls = counters[3];
+		rxCount = counters[4];
+		txCount = counters[5];
+		framingErrors = counters[6];
+		overrunErrors = counters[7];
+		parityErrors = counters[8];
+		breakCount = counters[9];
+		bufferOverrunErrors = counters[10];
+		driverCountersAvailable = driverCountersSupported;
+		timestamp = timestampNanos;
+	}
+
+	/**
+	 * Returns the time at which this snapshot was taken, as reported by {@link System#nanoTime()}.
+	 *
+	 * @return The time in nanoseconds at which this snapshot was taken.
+	 */
+	public final long getTimestampNanos() { return timestamp; }
+
+	/**
+	 * Returns the total number of bytes returned to the application by read calls since the port was opened.
+	 *
+	 * @return The total number of bytes read.
+	 */
+	public final long getBytesRead() { return bytesRead; }
+
+	/**
+	 * Returns the total number of bytes accepted by the device driver from write calls since the port was opened.
+	 *
+	 * @return The total number of bytes written.
+	 */
+	public final long getBytesWritten() { return bytesWritten; }
+
+	/**
+	 * Returns the number of read system calls issued to the device driver since the port was opened.
+	 *
+	 * @return The number of read system calls.
+	 */
+	public final long getReadCalls() { return readCalls; }
+
+	/**
+	 * Returns the number of write system calls issued to the device driver since the port was opened.
+	 *
+	 * @return The number of write system calls.
+	 */
+	public final long getWriteCalls() { return writeCalls; }
+
+	/**
+	 * Returns whether the device driver counters in this snapshot are valid.
+	 *
+	 * @return Whether driver-maintained line counters are available for this port.
+	 */
+	public final boolean areDriverCountersAvailable() { return driverCountersAvailable; }
+
+	/**
+	 * Returns the number of bytes received by the device driver.
+	 *
+	 * @return The driver-reported number of received bytes, or -1 if unavailable.
+	 */
+	public final long getDriverRxCount() { return rxCount; }
+
+	/**
+	 * Returns the number of bytes transmitted by the device driver.
+	 *
+	 * @return The driver-reported number of transmitted bytes, or -1 if unavailable.
+	 */
+	public final long getDriverTxCount() { return txCount; }
+
+	/**
+	 * Returns the number of framing errors detected by the device driver.
+	 *
+	 * @return The driver-reported number of framing errors, or -1 if unavailable.
+	 */
+	public final long getFramingErrorCount() { return framingErrors; }
+
+	/**
+	 * Returns the number of hardware overrun errors detected by the device driver.
+	 *
+	 * @return The driver-reported number of hardware overrun errors, or -1 if unavailable.
+	 */
+	public final long getOverrunErrorCount() { return overrunErrors; }
+
+	/**
+	 * Returns the number of parity errors detected by the device driver.
+	 *
+	 * @return The driver-reported number of parity errors, or -1 if unavailable.
+	 */
+	public final long getParityErrorCount() { return parityErrors; }
+
+	/**
+	 * Returns the number of break conditions detected by the device driver.
+	 *
+	 * @return The driver-reported number of break conditions, or -1 if unavailable.
+	 */
+	public final long getBreakCount() { return breakCount; }
+
+	/**
+	 * Returns the number of times the device driver's receive buffer overflowed.
+	 *
+	 * @return The driver-reported number of software buffer overruns, or -1 if unavailable.
+	 */
+	public final long getBufferOverrunErrorCount() { return bufferOverrunErrors; }
+}
@@ -0,0 +1,62 @@
+/*
+ * SerialPortMessageBatchListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to receive all messages framed from a single serial port read as one batch using event-based serial port I/O.
+ * <p>
+ * When combined with either the {@link SerialPortMessageListener} or the {@link SerialPortPacketListener} interface, all delimited messages or full
+ * packets that become complete within a single read from the serial port will be passed to the
+ * {@link #serialMessagesReceived(SerialPortEvent, byte[], int[], int[], int)} callback at once, as offsets and lengths into a shared internal buffer.
+ * Otherwise, each batch will contain exactly one entry describing all bytes received by that read.
+ * <p>
+ * All other serial port events will continue to be delivered via the {@link #serialEvent(SerialPortEvent)} callback.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see com.fazecast.jSerialComm.SerialPortPacketListener
+ * @see com.fazecast.jSerialComm.SerialPortMessageListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortMessageBatchListener extends SerialPortDataListener
+{
+	/**
+	 * Called whenever one or more messages have been received by the serial port, in place of the {@link #serialEvent(SerialPortEvent)} callback.
+	 * <p>
+	 * The message with index <i>i</i> occupies {@code lengths[i]} bytes of {@code data} starting at {@code offsets[i]}, for all <i>i</i> less
+	 * than {@code numMessages}. All passed-in arrays are owned by the serial port and will be reused for subsequent batches, so they may only
+	 * be accessed for the duration of this callback and must not be modified.
+	 * <p>
+	 * The passed-in {@code event} object is likewise reused for each callback. Its timestamps describe the first byte of the first message and the
+	 * last byte of the last message in the batch, and its {@link SerialPortEvent#getReceivedData()} method will return <i>null</i>.
+	 *
+	 * @param event A reusable {@link SerialPortEvent} describing the timing of the received batch.
+	 * @param data The internal buffer containing all received messages.
+	 * @param offsets The index of the first byte of each message within {@code data}.
+	 * @param lengths The number of bytes in each message.
+	 * @param numMessages The number of valid entries in the {@code offsets} and {@code lengths} arrays.
+	 */
+	void serialMessagesReceived(SerialPortEvent event, byte[] data, int[] offsets, int[] lengths, int numMessages);
+}
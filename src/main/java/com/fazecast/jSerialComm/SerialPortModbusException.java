@@ -0,0 +1,69 @@
+/*
+ * SerialPortModbusException.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.io.IOException;
+
+/**
+ * This class describes a Modbus exception response.
+ * <p>
+ * A {@link SerialPortModbusMaster} throws this exception whenever a slave replies to a request with an exception response, and a
+ * {@link SerialPortModbusRegisterMap} may throw it to have a {@link SerialPortModbusSlave} reply with the corresponding exception code.
+ *
+ * @see java.io.IOException
+ */
+public final class SerialPortModbusException extends IOException
+{
+	private static final long serialVersionUID = 6921648253401957213L;
+
+	// Standard Modbus exception codes
+	static final public int ILLEGAL_FUNCTION = 0x01;
+	static final public int ILLEGAL_DATA_ADDRESS = 0x02;
+	static final public int ILLEGAL_DATA_VALUE = 0x03;
+	static final public int SERVER_DEVICE_FAILURE = 0x04;
+	static final public int ACKNOWLEDGE = 0x05;
+	static final public int SERVER_DEVICE_BUSY = 0x06;
+
+	private final int exceptionCode;
+
+	/**
+	 * Constructs a {@link SerialPortModbusException} with the specified Modbus exception code.
+	 *
+	 * @param exceptionCode The Modbus exception code, such as {@link #ILLEGAL_DATA_ADDRESS}.
+	 */
+	public SerialPortModbusException(int exceptionCode)
+	{
+		super("Modbus exception response with code " + exceptionCode);
+		this.exceptionCode = exceptionCode;
+	}
+
+	/**
+	 * Returns the Modbus exception code associated with this exception.
+	 *
+	 * @return The Modbus exception code.
+	 */
+	public final int getExceptionCode() { return exceptionCode; }
+}
@@ -0,0 +1,357 @@
+/*
+ * SerialPortModbusMaster.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.io.IOException;
+
+/**
+ * This class implements a Modbus RTU master (client) on top of an opened {@link SerialPort}.
+ * <p>
+ * Request and response frames are sent and received in native code according to the Modbus RTU timing rules: each request is only transmitted once
+ * the bus has been silent for 3.5 character times, and each response is delimited by 1.5 character times of silence. Because the expected length of
+ * every response is known in advance, a response is returned as soon as its final byte arrives rather than after the trailing inter-frame gap,
+ * and the response timeout starts as soon as the final byte of the request has left the transmitter. Above 19200 baud, the fixed inter-character
+ * and inter-frame gaps of 750&mu;s and 1.75ms recommended by the Modbus specification are used. All frames are protected by a CRC-16 that is
+ * calculated and verified using {@link SerialPortCrc#CRC16_MODBUS}.
+ * <p>
+ * Any RS-485 settings configured on the serial port, such as {@link SerialPort#setRs485ModeParameters(boolean, boolean, boolean, boolean, int, int)},
+ * continue to control the transmitter. No data listeners should be registered on the port while it is being used by a Modbus master.
+ * <p>
+ * All request methods are thread-safe and are carried out one at a time. Requests addressed to unit ID 0 are broadcast to all slaves, do not wait
+ * for a response, and delay the next request by the configured broadcast turnaround delay.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortModbusSlave
+ * @see com.fazecast.jSerialComm.SerialPortModbusException
+ */
+public final class SerialPortModbusMaster
+{
+	// Modbus function codes
+	static private final int READ_COILS = 0x01, READ_DISCRETE_INPUTS = 0x02, READ_HOLDING_REGISTERS = 0x03, READ_INPUT_REGISTERS = 0x04;
+	static private final int WRITE_SINGLE_COIL = 0x05, WRITE_SINGLE_REGISTER = 0x06, WRITE_MULTIPLE_COILS = 0x0F, WRITE_MULTIPLE_REGISTERS = 0x10;
+	static private final int READ_WRITE_MULTIPLE_REGISTERS = 0x17;
+
+	// Modbus master state
+	private final SerialPort comPort;
+	private final byte[] request = new byte[256], response = new byte[256];
+	private volatile int responseTimeout, broadcastTurnaroundDelay = 100;
+	private long nextFrameGapNanos = 0;
+
+	/**
+	 * Constructs a new Modbus RTU master using the specified serial port and a response timeout of 1 second.
+	 *
+	 * @param serialPort The opened serial port connected to the Modbus bus.
+	 */
+	public SerialPortModbusMaster(SerialPort serialPort) { this(serialPort, 1000); }
+
+	/**
+	 * Constructs a new Modbus RTU master using the specified serial port and response timeout.
+	 *
+	 * @param serialPort The opened serial port connected to the Modbus bus.
+	 * @param responseTimeout The number of milliseconds to wait for the first byte of a response after a request has been transmitted.
+	 */
+	public SerialPortModbusMaster(SerialPort serialPort, int responseTimeout)
+	{
+		comPort = serialPort;
+		this.responseTimeout = Math.max(responseTimeout, 1);
+	}
+
+	/**
+	 * Returns the serial port used by this Modbus master.
+	 *
+	 * @return The underlying serial port.
+	 */
+	public final SerialPort getSerialPort() { return comPort; }
+
+	/**
+	 * Sets the number of milliseconds to wait for the first byte of a response after a request has been transmitted.
+	 *
+	 * @param responseTimeout The response timeout in milliseconds.
+	 */
+	public final void setResponseTimeout(int responseTimeout) { this.responseTimeout = Math.max(responseTimeout, 1); }
+
+	/**
+	 * Returns the number of milliseconds to wait for the first byte of a response after a request has been transmitted.
+	 *
+	 * @return The response timeout in milliseconds.
+	 */
+	public final int getResponseTimeout() { return responseTimeout; }
+
+	/**
+	 * Sets the minimum number of milliseconds between the end of a broadcast request and the start of the next request, giving all slaves time to
+	 * process the broadcast.
+	 *
+	 * @param broadcastTurnaroundDelay The broadcast turnaround delay in milliseconds.
+	 */
+	public final void setBroadcastTurnaroundDelay(int broadcastTurnaroundDelay) { this.broadcastTurnaroundDelay = Math.max(broadcastTurnaroundDelay, 0); }
+
+	/**
+	 * Returns the minimum number of milliseconds between the end of a broadcast request and the start of the next request.
+	 *
+	 * @return The broadcast turnaround delay in milliseconds.
+	 */
+	public final int getBroadcastTurnaroundDelay() { return broadcastTurnaroundDelay; }
+
+	/**
+	 * Reads a contiguous range of coils from a slave (function code 1).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247.
+	 * @param address The address of the first coil to read.
+	 * @param quantity The number of coils to read, between 1 and 2000.
+	 * @return The states of the requested coils.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized boolean[] readCoils(int unitId, int address, int quantity) throws IOException { return readBits(READ_COILS, unitId, address, quantity); }
+
+	/**
+	 * Reads a contiguous range of discrete inputs from a slave (function code 2).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247.
+	 * @param address The address of the first discrete input to read.
+	 * @param quantity The number of discrete inputs to read, between 1 and 2000.
+	 * @return The states of the requested discrete inputs.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized boolean[] readDiscreteInputs(int unitId, int address, int quantity) throws IOException { return readBits(READ_DISCRETE_INPUTS, unitId, address, quantity); }
+
+	/**
+	 * Reads a contiguous range of holding registers from a slave (function code 3).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247.
+	 * @param address The address of the first holding register to read.
+	 * @param quantity The number of holding registers to read, between 1 and 125.
+	 * @return The unsigned 16-bit values of the requested registers.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized int[] readHoldingRegisters(int unitId, int address, int quantity) throws IOException { return readRegisters(READ_HOLDING_REGISTERS, unitId, address, quantity); }
+
+	/**
+	 * Reads a contiguous range of input registers from a slave (function code 4).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247.
+	 * @param address The address of the first input register to read.
+	 * @param quantity The number of input registers to read, between 1 and 125.
+	 * @return The unsigned 16-bit values of the requested registers.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized int[] readInputRegisters(int unitId, int address, int quantity) throws IOException { return readRegisters(READ_INPUT_REGISTERS, unitId, address, quantity); }
+
+	/**
+	 * Writes a single coil on a slave (function code 5).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247, or 0 to broadcast the request to all slaves.
+	 * @param address The address of the coil to write.
+	 * @param value The new state of the coil.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized void writeSingleCoil(int unitId, int address, boolean value) throws IOException
+	{
+		checkRequest(unitId, true, address, 1, 1);
+		putShort(4, value ? 0xFF00 : 0x0000);
+		transact(WRITE_SINGLE_COIL, unitId, address, 6, 6);
+	}
+
+	/**
+	 * Writes a single holding register on a slave (function code 6).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247, or 0 to broadcast the request to all slaves.
+	 * @param address The address of the register to write.
+	 * @param value The new unsigned 16-bit value of the register.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized void writeSingleRegister(int unitId, int address, int value) throws IOException
+	{
+		checkRequest(unitId, true, address, 1, 1);
+		putShort(4, value);
+		transact(WRITE_SINGLE_REGISTER, unitId, address, 6, 6);
+	}
+
+	/**
+	 * Writes a contiguous range of coils on a slave (function code 15).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247, or 0 to broadcast the request to all slaves.
+	 * @param address The address of the first coil to write.
+	 * @param values The new states of the coils, containing between 1 and 1968 values.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized void writeMultipleCoils(int unitId, int address, boolean[] values) throws IOException
+	{
+		checkRequest(unitId, true, address, values.length, 1968);
+		int byteCount = (values.length + 7) / 8;
+		putShort(4, values.length);
+		request[6] = (byte)byteCount;
+		packBits(values, request, 7);
+		transact(WRITE_MULTIPLE_COILS, unitId, address, 7 + byteCount, 6);
+	}
+
+	/**
+	 * Writes a contiguous range of holding registers on a slave (function code 16).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247, or 0 to broadcast the request to all slaves.
+	 * @param address The address of the first register to write.
+	 * @param values The new unsigned 16-bit values of the registers, containing between 1 and 123 values.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized void writeMultipleRegisters(int unitId, int address, int[] values) throws IOException
+	{
+		checkRequest(unitId, true, address, values.length, 123);
+		putShort(4, values.length);
+		request[6] = (byte)(2 * values.length);
+		for (int i = 0; i < values.length; ++i)
+			putShort(7 + (2 * i), values[i]);
+		transact(WRITE_MULTIPLE_REGISTERS, unitId, address, 7 + (2 * values.length), 6);
+	}
+
+	/**
+	 * Writes a contiguous range of holding registers on a slave and then reads a contiguous range of holding registers from the same slave as a
+	 * single transaction (function code 23).
+	 *
+	 * @param unitId The unit ID of the slave, between 1 and 247.
+	 * @param readAddress The address of the first holding register to read.
+	 * @param readQuantity The number of holding registers to read, between 1 and 125.
+	 * @param writeAddress The address of the first holding register to write.
+	 * @param values The new unsigned 16-bit values of the registers to write, containing between 1 and 121 values.
+	 * @return The unsigned 16-bit values of the requested registers, read after the write has been carried out.
+	 * @throws SerialPortModbusException If the slave replied with an exception response.
+	 * @throws SerialPortTimeoutException If the slave did not respond within the response timeout.
+	 * @throws IOException If the request could not be written or the response was corrupt.
+	 */
+	public final synchronized int[] readWriteMultipleRegisters(int unitId, int readAddress, int readQuantity, int writeAddress, int[] values) throws IOException
+	{
+		checkRequest(unitId, false, readAddress, readQuantity, 125);
+		checkRequest(unitId, false, writeAddress, values.length, 121);
+		putShort(4, readQuantity);
+		putShort(6, writeAddress);
+		putShort(8, values.length);
+		request[10] = (byte)(2 * values.length);
+		for (int i = 0; i < values.length; ++i)
+			putShort(11 + (2 * i), values[i]);
+		transact(READ_WRITE_MULTIPLE_REGISTERS, unitId, readAddress, 11 + (2 * values.length), 3 + (2 * readQuantity));
+		return unpackRegisters(readQuantity);
+	}
+
+	private boolean[] readBits(int functionCode, int unitId, int address, int quantity) throws IOException
+	{
+		checkRequest(unitId, false, address, quantity, 2000);
+		putShort(4, quantity);
+		transact(functionCode, unitId, address, 6, 3 + ((quantity + 7) / 8));
+		boolean[] values = new boolean[quantity];
+		for (int i = 0; i < quantity; ++i)
+			values[i] = (response[3 + (i / 8)] & (1 << (i % 8))) != 0;
+		return values;
+	}
+
+	private int[] readRegisters(int functionCode, int unitId, int address, int quantity) throws IOException
+	{
+		checkRequest(unitId, false, address, quantity, 125);
+		putShort(4, quantity);
+		transact(functionCode, unitId, address, 6, 3 + (2 * quantity));
+		return unpackRegisters(quantity);
+	}
+
+	private void transact(int functionCode, int unitId, int address, int requestLength, int responseLength) throws IOException
+	{
+		// Calculate the inter-character and inter-frame gaps for the current serial port settings
+		double characterTimeNanos = comPort.getCharacterTimeNanos();
+		long characterGapNanos = (comPort.getBaudRate() > 19200) ? 750000L : (long)(1.5 * characterTimeNanos);
+		long frameGapNanos = (comPort.getBaudRate() > 19200) ? 1750000L : (long)(3.5 * characterTimeNanos);
+
+		// Complete the request header and CRC, then transmit it once the bus has been idle for long enough
+		request[0] = (byte)unitId;
+		request[1] = (byte)functionCode;
+		putShort(2, address);
+		requestLength = SerialPortCrc.CRC16_MODBUS.append(request, 0, requestLength, false);
+		int numWritten = comPort.writeModbusFrame(request, requestLength, Math.max(frameGapNanos, nextFrameGapNanos));
+		nextFrameGapNanos = (unitId == 0) ? (broadcastTurnaroundDelay * 1000000L) : 0;
+		if (numWritten != requestLength)
+			throw new SerialPortIOException("Unable to write Modbus request to the serial port");
+		else if (unitId == 0)
+			return;
+
+		// Receive and validate the response, returning as soon as the expected number of bytes has arrived
+		int numRead = comPort.readModbusFrame(response, responseLength + 2, characterGapNanos, frameGapNanos, responseTimeout);
+		if (numRead == 0)
+			throw new SerialPortTimeoutException("No Modbus response was received from unit " + unitId + " within the response timeout");
+		else if (numRead == -1)
+			throw new SerialPortIOException("Unable to read Modbus response from the serial port");
+		else if ((numRead < 5) || !SerialPortCrc.CRC16_MODBUS.verify(response, 0, numRead, false))
+			throw new SerialPortIOException("Received a corrupt Modbus response from unit " + unitId);
+		else if ((response[0] != request[0]) || ((response[1] & 0x7F) != functionCode))
+			throw new SerialPortIOException("Received a Modbus response that does not match the request to unit " + unitId);
+		else if ((response[1] & 0x80) != 0)
+			throw new SerialPortModbusException(response[2] & 0xFF);
+		else if ((numRead != (responseLength + 2)) || ((responseLength == 6) ? (getShort(response, 2) != address) : ((response[2] & 0xFF) != (responseLength - 3))))
+			throw new SerialPortIOException("Received a Modbus response of unexpected length from unit " + unitId);
+	}
+
+	private void checkRequest(int unitId, boolean broadcastAllowed, int address, int quantity, int maxQuantity)
+	{
+		if ((unitId < (broadcastAllowed ? 0 : 1)) || (unitId > 247))
+			throw new IllegalArgumentException("Invalid Modbus unit ID: " + unitId);
+		else if ((address < 0) || (address > 0xFFFF) || (quantity < 1) || (quantity > maxQuantity) || ((address + quantity) > 0x10000))
+			throw new IllegalArgumentException("Invalid Modbus address range: " + address + " (" + quantity + " values)");
+	}
+
+	private int[] unpackRegisters(int quantity)
+	{
+		int[] values = new int[quantity];
+		for (int i = 0; i < quantity; ++i)
+			values[i] = getShort(response, 3 + (2 * i));
+		return values;
+	}
+
+	private void putShort(int offset, int value)
+	{
+		request[offset] = (byte)(value >>> 8);
+		request[offset + 1] = (byte)value;
+	}
+
+	static int getShort(byte[] buffer, int offset) { return ((buffer[offset] & 0xFF) << 8) | (buffer[offset + 1] & 0xFF); }
+
+	static void packBits(boolean[] values, byte[] buffer, int offset)
+	{
+		for (int i = 0; i < ((values.length + 7) / 8); ++i)
+			buffer[offset + i] = 0;
+		for (int i = 0; i < values.length; ++i)
+			if (values[i])
+				buffer[offset + (i / 8)] |= (byte)(1 << (i % 8));
+	}
+}
@@ -0,0 +1,93 @@
+/*
+ * SerialPortModbusRegisterMap.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to provide the coils and registers served by a {@link SerialPortModbusSlave}.
+ * <p>
+ * Each callback is invoked from the slave's request-processing thread after a valid request frame has been received. Any callback may throw a
+ * {@link SerialPortModbusException} to have the slave reply with the corresponding exception code, such as
+ * {@link SerialPortModbusException#ILLEGAL_DATA_ADDRESS} for an address range that is not implemented. Any other exception thrown by a callback
+ * results in a {@link SerialPortModbusException#SERVER_DEVICE_FAILURE} reply.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortModbusSlave
+ */
+public interface SerialPortModbusRegisterMap
+{
+	/**
+	 * Must be overridden to read a contiguous range of coils (function code 1).
+	 *
+	 * @param address The address of the first coil to read.
+	 * @param values The array to fill with the requested coil states.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void readCoils(int address, boolean[] values) throws SerialPortModbusException;
+
+	/**
+	 * Must be overridden to read a contiguous range of discrete inputs (function code 2).
+	 *
+	 * @param address The address of the first discrete input to read.
+	 * @param values The array to fill with the requested input states.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void readDiscreteInputs(int address, boolean[] values) throws SerialPortModbusException;
+
+	/**
+	 * Must be overridden to read a contiguous range of holding registers (function codes 3 and 23).
+	 *
+	 * @param address The address of the first holding register to read.
+	 * @param values The array to fill with the requested 16-bit register values.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void readHoldingRegisters(int address, int[] values) throws SerialPortModbusException;
+
+	/**
+	 * Must be overridden to read a contiguous range of input registers (function code 4).
+	 *
+	 * @param address The address of the first input register to read.
+	 * @param values The array to fill with the requested 16-bit register values.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void readInputRegisters(int address, int[] values) throws SerialPortModbusException;
+
+	/**
+	 * Must be overridden to write a contiguous range of coils (function codes 5 and 15).
+	 *
+	 * @param address The address of the first coil to write.
+	 * @param values The new coil states.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void writeCoils(int address, boolean[] values) throws SerialPortModbusException;
+
+	/**
+	 * Must be overridden to write a contiguous range of holding registers (function codes 6, 16, and 23).
+	 *
+	 * @param address The address of the first holding register to write.
+	 * @param values The new 16-bit register values.
+	 * @throws SerialPortModbusException If the request cannot be fulfilled.
+	 */
+	void writeHoldingRegisters(int address, int[] values) throws SerialPortModbusException;
+}
@@ -0,0 +1,329 @@
+/*
+ * SerialPortModbusSlave.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.io.IOException;
+
+/**
+ * This class implements a Modbus RTU slave (server) on top of an opened {@link SerialPort}.
+ * <p>
+ * Request frames are received in native code according to the Modbus RTU timing rules: each frame is delimited by 1.5 character times of silence,
+ * and any frame that is followed by further data before 3.5 character times of silence have elapsed is discarded as corrupt. Valid requests addressed
+ * to this slave's unit ID or broadcast to unit ID 0 are served using a {@link SerialPortModbusRegisterMap}, and responses are transmitted as soon as
+ * the required inter-frame gap has elapsed. Function codes 1-6, 15, 16, and 23 are supported; all other function codes are answered with a
+ * {@link SerialPortModbusException#ILLEGAL_FUNCTION} exception response. All frames are protected by a CRC-16 that is calculated and verified
+ * using {@link SerialPortCrc#CRC16_MODBUS}.
+ * <p>
+ * Requests may either be served by a background thread using {@link #start()} and {@link #stop()}, or one at a time by the application using
+ * {@link #processRequest(int)}. No data listeners should be registered on the port while it is being used by a Modbus slave.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortModbusMaster
+ * @see com.fazecast.jSerialComm.SerialPortModbusRegisterMap
+ */
+public final class SerialPortModbusSlave
+{
+	// Modbus slave state
+	private final SerialPort comPort;
+	private final SerialPortModbusRegisterMap registerMap;
+	private final int unitId;
+	private final byte[] request = new byte[256], response = new byte[256];
+	private volatile boolean running = false;
+	private volatile long requestCount = 0, exceptionResponseCount = 0, corruptFrameCount = 0;
+	private volatile IOException stopException = null;
+	private Thread requestThread = null;
+
+	/**
+	 * Constructs a new Modbus RTU slave using the specified serial port, unit ID, and register map.
+	 *
+	 * @param serialPort The opened serial port connected to the Modbus bus.
+	 * @param unitId The unit ID of this slave, between 1 and 247.
+	 * @param registerMap The register map used to serve all requests.
+	 * @throws IllegalArgumentException If the unit ID is not between 1 and 247.
+	 */
+	public SerialPortModbusSlave(SerialPort serialPort, int unitId, SerialPortModbusRegisterMap registerMap) throws IllegalArgumentException
+	{
+		if ((unitId < 1) || (unitId > 247))
+			throw new IllegalArgumentException("Invalid Modbus unit ID: " + unitId);
+		comPort = serialPort;
+		this.unitId = unitId;
+		this.registerMap = registerMap;
+	}
+
+	/**
+	 * Returns the unit ID of this slave.
+	 *
+	 * @return The Modbus unit ID.
+	 */
+	public final int getUnitId() { return unitId; }
+
+	/**
+	 * Returns the number of valid requests that have been served by this slave, including broadcast requests.
+	 *
+	 * @return The number of served requests.
+	 */
+	public final long getRequestCount() { return requestCount; }
+
+	/**
+	 * Returns the number of requests that have been answered with an exception response.
+	 *
+	 * @return The number of exception responses.
+	 */
+	public final long getExceptionResponseCount() { return exceptionResponseCount; }
+
+	/**
+	 * Returns the number of received frames that have been discarded due to an invalid CRC or a violation of the inter-character timing rules.
+	 *
+	 * @return The number of corrupt frames.
+	 */
+	public final long getCorruptFrameCount() { return corruptFrameCount; }
+
+	/**
+	 * Returns whether this slave is currently serving requests in a background thread.
+	 *
+	 * @return Whether the request-processing thread is running.
+	 */
+	public final boolean isRunning() { return running; }
+
+	/**
+	 * Returns the exception that caused the background request-processing thread to stop unexpectedly.
+	 * <p>
+	 * The background thread stops as soon as the serial port can no longer be read or written. This exception is cleared whenever the thread is
+	 * started again using {@link #start()}.
+	 *
+	 * @return The exception that stopped the request-processing thread, or null if it has not stopped due to an error.
+	 */
+	public final IOException getStopException() { return stopException; }
+
+	/**
+	 * Starts serving requests in a background thread created by the {@link SerialPortThreadFactory}.
+	 * <p>
+	 * If the serial port can no longer be read or written, the thread stops and the exception that stopped it can be retrieved using
+	 * {@link #getStopException()}.
+	 *
+	 * @return Whether the request-processing thread was started, or false if it was already running.
+	 */
+	public final synchronized boolean start()
+	{
+		if (running)
+			return false;
+		running = true;
+		stopException = null;
+		requestThread = SerialPortThreadFactory.get().newThread(new Runnable()
+		{
+			@Override
+			public void run()
+			{
+				while (running && comPort.isOpen())
+				{
+					try { processRequest(100); }
+					catch (IOException e)
+					{
+						stopException = e;
+						running = false;
+					}
+				}
+				running = false;
+			}
+		});
+		requestThread.start();
+		return true;
+	}
+
+	/**
+	 * Stops serving requests and waits for the background request-processing thread to exit.
+	 */
+	public final synchronized void stop()
+	{
+		running = false;
+		try
+		{
+			if ((requestThread != null) && !Thread.currentThread().equals(requestThread))
+				requestThread.join();
+		}
+		catch (InterruptedException e) { Thread.currentThread().interrupt(); }
+		requestThread = null;
+	}
+
+	/**
+	 * Waits for a single request frame and serves it if it is addressed to this slave.
+	 * <p>
+	 * This method must not be called while the background request-processing thread is running.
+	 *
+	 * @param timeout The number of milliseconds to wait for the start of a request.
+	 * @return Whether a valid request addressed to this slave was received and served.
+	 * @throws IOException If the serial port could not be read or written.
+	 */
+	public final boolean processRequest(int timeout) throws IOException
+	{
+		// Calculate the inter-character and inter-frame gaps for the current serial port settings
+		double characterTimeNanos = comPort.getCharacterTimeNanos();
+		long characterGapNanos = (comPort.getBaudRate() > 19200) ? 750000L : (long)(1.5 * characterTimeNanos);
+		long frameGapNanos = (comPort.getBaudRate() > 19200) ? 1750000L : (long)(3.5 * characterTimeNanos);
+
+		// Receive the next complete request frame, which is only returned once the full inter-frame gap has elapsed
+		int numRead = comPort.readModbusFrame(request, 0, characterGapNanos, frameGapNanos, Math.max(timeout, 1));
+		if (numRead == -1)
+			throw new SerialPortIOException("Unable to read Modbus request from the serial port");
+		else if (numRead == 0)
+			return false;
+		else if ((numRead < 4) || !SerialPortCrc.CRC16_MODBUS.verify(request, 0, numRead, false))
+		{
+			++corruptFrameCount;
+			return false;
+		}
+		int requestUnitId = request[0] & 0xFF;
+		if ((requestUnitId != unitId) && (requestUnitId != 0))
+			return false;
+
+		// Serve the request and reply unless it was broadcast
+		int responseLength;
+		++requestCount;
+		try { responseLength = serveRequest(numRead - 2); }
+		catch (SerialPortModbusException e) { responseLength = exceptionResponse(e.getExceptionCode()); }
+		catch (RuntimeException e) { responseLength = exceptionResponse(SerialPortModbusException.SERVER_DEVICE_FAILURE); }
+		if (requestUnitId != 0)
+		{
+			response[0] = (byte)unitId;
+			responseLength = SerialPortCrc.CRC16_MODBUS.append(response, 0, responseLength, false);
+			if (comPort.writeModbusFrame(response, responseLength, frameGapNanos) != responseLength)
+				throw new SerialPortIOException("Unable to write Modbus response to the serial port");
+		}
+		return true;
+	}
+
+	private int serveRequest(int requestLength) throws SerialPortModbusException
+	{
+		// Parse the request header
+		int functionCode = request[1] & 0xFF;
+		if ((functionCode == 0) || (functionCode > 0x17) || ((functionCode > 0x06) && (functionCode != 0x0F) && (functionCode != 0x10) && (functionCode != 0x17)))
+			throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_FUNCTION);
+		else if (requestLength < 6)
+			throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+		int address = SerialPortModbusMaster.getShort(request, 2), value = SerialPortModbusMaster.getShort(request, 4);
+		response[1] = (byte)functionCode;
+		switch (functionCode)
+		{
+			case 0x01:
+			case 0x02:
+			{
+				boolean[] values = new boolean[checkQuantity(address, value, 2000)];
+				if (functionCode == 0x01)
+					registerMap.readCoils(address, values);
+				else
+					registerMap.readDiscreteInputs(address, values);
+				response[2] = (byte)((values.length + 7) / 8);
+				SerialPortModbusMaster.packBits(values, response, 3);
+				return 3 + (response[2] & 0xFF);
+			}
+			case 0x03:
+			case 0x04:
+			{
+				int[] values = new int[checkQuantity(address, value, 125)];
+				if (functionCode == 0x03)
+					registerMap.readHoldingRegisters(address, values);
+				else
+					registerMap.readInputRegisters(address, values);
+				return putRegisters(values);
+			}
+			case 0x05:
+				if ((value != 0xFF00) && (value != 0x0000))
+					throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+				registerMap.writeCoils(address, new boolean[] { value == 0xFF00 });
+				System.arraycopy(request, 2, response, 2, 4);
+				return 6;
+			case 0x06:
+				registerMap.writeHoldingRegisters(address, new int[] { value });
+				System.arraycopy(request, 2, response, 2, 4);
+				return 6;
+			case 0x0F:
+			{
+				boolean[] values = new boolean[checkQuantity(address, value, 1968)];
+				if ((requestLength < 7) || ((request[6] & 0xFF) != ((values.length + 7) / 8)) || (requestLength != (7 + (request[6] & 0xFF))))
+					throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+				for (int i = 0; i < values.length; ++i)
+					values[i] = (request[7 + (i / 8)] & (1 << (i % 8))) != 0;
+				registerMap.writeCoils(address, values);
+				System.arraycopy(request, 2, response, 2, 4);
+				return 6;
+			}
+			case 0x10:
+			{
+				int[] values = new int[checkQuantity(address, value, 123)];
+				if ((requestLength < 7) || ((request[6] & 0xFF) != (2 * values.length)) || (requestLength != (7 + (2 * values.length))))
+					throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+				for (int i = 0; i < values.length; ++i)
+					values[i] = SerialPortModbusMaster.getShort(request, 7 + (2 * i));
+				registerMap.writeHoldingRegisters(address, values);
+				System.arraycopy(request, 2, response, 2, 4);
+				return 6;
+			}
+			default:
+			{
+				// Read/Write Multiple Registers performs its write before its read
+				if (requestLength < 11)
+					throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+				int[] readValues = new int[checkQuantity(address, value, 125)];
+				int writeAddress = SerialPortModbusMaster.getShort(request, 6);
+				int[] writeValues = new int[checkQuantity(writeAddress, SerialPortModbusMaster.getShort(request, 8), 121)];
+				if (((request[10] & 0xFF) != (2 * writeValues.length)) || (requestLength != (11 + (2 * writeValues.length))))
+					throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+				for (int i = 0; i < writeValues.length; ++i)
+					writeValues[i] = SerialPortModbusMaster.getShort(request, 11 + (2 * i));
+				registerMap.writeHoldingRegisters(writeAddress, writeValues);
+				registerMap.readHoldingRegisters(address, readValues);
+				return putRegisters(readValues);
+			}
+		}
+	}
+
+	private int checkQuantity(int address, int quantity, int maxQuantity) throws SerialPortModbusException
+	{
+		if ((quantity < 1) || (quantity > maxQuantity))
+			throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_VALUE);
+		else if ((address + quantity) > 0x10000)
+			throw new SerialPortModbusException(SerialPortModbusException.ILLEGAL_DATA_ADDRESS);
+		return quantity;
+	}
+
+	private int putRegisters(int[] values)
+	{
+		response[2] = (byte)(2 * values.length);
+		for (int i = 0; i < values.length; ++i)
+		{
+			response[3 + (2 * i)] = (byte)(values[i] >>> 8);
+			response[4 + (2 * i)] = (byte)values[i];
+		}
+		return 3 + (2 * values.length);
+	}
+
+	private int exceptionResponse(int exceptionCode)
+	{
+		++exceptionResponseCount;
+		response[1] = (byte)(request[1] | 0x80);
+		response[2] = (byte)exceptionCode;
+		return 3;
+	}
+}
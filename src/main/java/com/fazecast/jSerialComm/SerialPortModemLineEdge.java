@@ -0,0 +1,106 @@
+/*
+ * SerialPortModemLineEdge.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class describes a single timestamped transition of a modem control line.
+ *
+ * @see SerialPort#startModemLineEdgeCapture(int)
+ * @see SerialPort#readModemLineEdges()
+ */
+public final class SerialPortModemLineEdge
+{
+	private final SerialPort serialPort;
+	private final int controlLine;
+	private final boolean asserted;
+	private final long timestamp;
+
+	/**
+	 * Constructs a {@link SerialPortModemLineEdge} object describing a transition of the specified control line.
+	 *
+	 * @param comPort The {@link SerialPort} on which the transition occurred.
+	 * @param line The control line that changed state.
+	 * @param isAsserted Whether the control line was asserted after the transition.
+	 * @param timestampNanos The monotonic time in nanoseconds at which the transition was detected.
+	 */
+	public SerialPortModemLineEdge(SerialPort comPort, int line, boolean isAsserted, long timestampNanos)
+	{
+		serialPort = comPort;
+		controlLine = line;
+		asserted = isAsserted;
+		timestamp = timestampNanos;
+	}
+
+	/**
+	 * Returns the {@link SerialPort} on which this transition occurred.
+	 *
+	 * @return The {@link SerialPort} on which this transition occurred.
+	 */
+	public final SerialPort getSerialPort() { return serialPort; }
+
+	/**
+	 * Returns the control line that changed state.
+	 * <p>
+	 * The returned value will be one of the following:
+	 * <p>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_CARRIER_DETECT}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_CTS}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_DSR}<br>
+	 * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp;{@link SerialPort#LISTENING_EVENT_RING_INDICATOR}
+	 *
+	 * @return The control line that changed state.
+	 */
+	public final int getControlLine() { return controlLine; }
+
+	/**
+	 * Returns whether the control line was asserted immediately after this transition.
+	 *
+	 * @return Whether the control line was asserted after the transition.
+	 */
+	public final boolean isAsserted() { return asserted; }
+
+	/**
+	 * Returns the time at which this transition was detected by the native library.
+	 * <p>
+	 * Timestamps are expressed in nanoseconds using the same monotonic time source as {@link SerialPortEvent#getTimestampNanos()}.
+	 *
+	 * @return The monotonic time in nanoseconds at which the transition was detected.
+	 */
+	public final long getTimestampNanos() { return timestamp; }
+
+	/**
+	 * Returns a string representation of this control line transition.
+	 *
+	 * @return A string representation of this control line transition.
+	 */
+	@Override
+	public final String toString()
+	{
+		String lineName = (controlLine == SerialPort.LISTENING_EVENT_CARRIER_DETECT) ? "DCD" : ((controlLine == SerialPort.LISTENING_EVENT_CTS) ? "CTS" :
+			((controlLine == SerialPort.LISTENING_EVENT_DSR) ? "DSR" : ((controlLine == SerialPort.LISTENING_EVENT_RING_INDICATOR) ? "RI" : "UNKNOWN")));
+		return lineName + (asserted ? " asserted at " : " deasserted at ") + timestamp;
+	}
+}
@@ -0,0 +1,71 @@
+/*
+ * SerialPortPatternListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to be notified whenever any of a set of byte patterns is encountered in the received data stream.
+ * <p>
+ * All patterns returned by {@link #getPatterns()} are compiled into a single Aho-Corasick automaton when the listener is registered using
+ * {@link SerialPort#addDataListener(SerialPortDataListener)}, and all received data is then scanned in native code using that automaton. Patterns are
+ * detected even when they span multiple reads or overlap one another, and every occurrence of every pattern is reported to the
+ * {@link #patternMatched(SerialPortEvent, int, long)} callback in the order in which the patterns end in the stream.
+ * <p>
+ * If the {@link #getListeningEvents()} method of this listener also includes {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED}, the received data itself
+ * will additionally be delivered in the usual manner, and this interface may be combined with the {@link SerialPortPacketListener},
+ * {@link SerialPortMessageListener} or {@link SerialPortDataBufferListener} interfaces. Otherwise, only pattern matches and any other requested events
+ * will be reported.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortPatternListener extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the byte patterns to search for in the received data stream.
+	 * <p>
+	 * The index of each pattern within the returned array is used as its pattern ID in the {@link #patternMatched(SerialPortEvent, int, long)} callback.
+	 * This method is only called once when the listener is registered. Empty patterns are ignored, and if the same pattern appears more than once,
+	 * only its lowest pattern ID will be reported.
+	 *
+	 * @return An array containing all byte patterns for which to search.
+	 */
+	byte[][] getPatterns();
+
+	/**
+	 * Called whenever one of the patterns returned by {@link #getPatterns()} has been received by the serial port.
+	 * <p>
+	 * The passed-in {@code event} object will always be of type {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED}. Its timestamps describe the read
+	 * during which the final byte of the pattern was received, and its {@link SerialPortEvent#getReceivedData()} method will return <i>null</i>.
+	 * The event object may be reused for subsequent callbacks.
+	 *
+	 * @param event A {@link SerialPortEvent} describing the timing of the match.
+	 * @param patternId The index of the matched pattern within the array returned by {@link #getPatterns()}.
+	 * @param streamOffset The number of bytes received since event listening began and before the first byte of the matched pattern.
+	 */
+	void patternMatched(SerialPortEvent event, int patternId, long streamOffset);
+}
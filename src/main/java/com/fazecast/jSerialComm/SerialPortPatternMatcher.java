@@ -0,0 +1,108 @@
+/*
+ * SerialPortPatternMatcher.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.util.Arrays;
+
+// Package-private class compiling a set of byte patterns into a deterministic Aho-Corasick automaton
+final class SerialPortPatternMatcher
+{
+	// Automaton layout: [numStates * 256 state transitions][numStates matched pattern IDs][numStates output links]
+	private final int[] automaton;
+	private final int[] patternLengths;
+	private final int maxMatchesPerByte;
+
+	public SerialPortPatternMatcher(byte[][] patterns)
+	{
+		// Build a trie containing all non-empty patterns
+		int maxStates = 1;
+		patternLengths = new int[patterns.length];
+		for (int i = 0; i < patterns.length; ++i)
+		{
+			patternLengths[i] = (patterns[i] == null) ? 0 : patterns[i].length;
+			maxStates += patternLengths[i];
+		}
+		int numStates = 1;
+		int[] transitions = new int[maxStates * 256], patternIds = new int[maxStates];
+		Arrays.fill(transitions, -1);
+		Arrays.fill(patternIds, -1);
+		for (int i = 0; i < patterns.length; ++i)
+		{
+			if (patternLengths[i] == 0)
+				continue;
+			int state = 0;
+			for (byte patternByte : patterns[i])
+			{
+				int transition = (state << 8) | (patternByte & 0xFF);
+				if (transitions[transition] < 0)
+					transitions[transition] = numStates++;
+				state = transitions[transition];
+			}
+			if (patternIds[state] < 0)
+				patternIds[state] = i;
+		}
+
+		// Resolve failure transitions breadth-first so that every state has a direct transition for every possible byte
+		int[] failureLinks = new int[numStates], outputLinks = new int[numStates], outputCounts = new int[numStates], stateQueue = new int[numStates];
+		int queueHead = 0, queueTail = 0, maxOutputs = 1;
+		for (int value = 0; value < 256; ++value)
+			if (transitions[value] < 0)
+				transitions[value] = 0;
+			else
+				stateQueue[queueTail++] = transitions[value];
+		while (queueHead < queueTail)
+		{
+			int state = stateQueue[queueHead++], failureState = failureLinks[state];
+			outputLinks[state] = (patternIds[failureState] >= 0) ? failureState : outputLinks[failureState];
+			outputCounts[state] = outputCounts[failureState] + ((patternIds[state] >= 0) ? 1 : 0);
+			maxOutputs = Math.max(maxOutputs, outputCounts[state]);
+			for (int value = 0; value < 256; ++value)
+			{
+				int transition = (state << 8) | value;
+				if (transitions[transition] < 0)
+					transitions[transition] = transitions[(failureState << 8) | value];
+				else
+				{
+					failureLinks[transitions[transition]] = transitions[(failureState << 8) | value];
+					stateQueue[queueTail++] = transitions[transition];
+				}
+			}
+		}
+
+		// Pack the automaton into a single array for native scanning
+		automaton = new int[numStates * 258];
+		System.arraycopy(transitions, 0, automaton, 0, numStates * 256);
+		System.arraycopy(patternIds, 0, automaton, numStates * 256, numStates);
+		System.arraycopy(outputLinks, 0, automaton, numStates * 257, numStates);
+		maxMatchesPerByte = maxOutputs;
+	}
+
+	public final int[] getAutomaton() { return automaton; }
+
+	public final int getPatternLength(int patternId) { return patternLengths[patternId]; }
+
+	public final int getMaxMatchesPerByte() { return maxMatchesPerByte; }
+}
@@ -0,0 +1,92 @@
+/*
+ * SerialPortPollJob.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class describes a single periodic poll carried out by a {@link SerialPortPollScheduler}.
+ * <p>
+ * Each job is released once per period, and the deadline of each release is the start of the following period. The priority of a job is only
+ * used to order jobs with identical deadlines and to decide which overdue jobs to serve first when the bus is overloaded.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortPollScheduler
+ */
+public final class SerialPortPollJob
+{
+	private final int address, period, priority;
+	private final byte[] request;
+	long nextReleaseNanos = 0;
+
+	/**
+	 * Constructs a new periodic poll job.
+	 *
+	 * @param address The address of the polled slave, which is used to group the scheduler statistics.
+	 * @param request The complete request to send to the slave, which is copied by this constructor.
+	 * @param period The number of milliseconds between consecutive releases of this job.
+	 * @param priority The priority of this job, where larger values are served first.
+	 * @throws IllegalArgumentException If the period is not positive.
+	 */
+	public SerialPortPollJob(int address, byte[] request, int period, int priority) throws IllegalArgumentException
+	{
+		if (period <= 0)
+			throw new IllegalArgumentException("The poll period must be positive");
+		this.address = address;
+		this.request = request.clone();
+		this.period = period;
+		this.priority = priority;
+	}
+
+	/**
+	 * Returns the address of the polled slave.
+	 *
+	 * @return The slave address.
+	 */
+	public final int getAddress() { return address; }
+
+	/**
+	 * Returns a copy of the request sent by this job.
+	 *
+	 * @return The request bytes.
+	 */
+	public final byte[] getRequest() { return request.clone(); }
+
+	/**
+	 * Returns the number of milliseconds between consecutive releases of this job.
+	 *
+	 * @return The poll period in milliseconds.
+	 */
+	public final int getPeriod() { return period; }
+
+	/**
+	 * Returns the priority of this job.
+	 *
+	 * @return The job priority, where larger values are served first.
+	 */
+	public final int getPriority() { return priority; }
+
+	// Package-private accessors used by the scheduler
+	final byte[] getRequestBytes() { return request; }
+	final long getPeriodNanos() { return period * 1000000L; }
+}
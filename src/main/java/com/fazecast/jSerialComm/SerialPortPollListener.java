@@ -0,0 +1,54 @@
+/*
+ * SerialPortPollListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to receive the results of the periodic polls carried out by a {@link SerialPortPollScheduler}.
+ * <p>
+ * All callbacks are invoked from the scheduler's polling thread, so they should return quickly to avoid delaying subsequent polls. Any runtime
+ * exception thrown from a callback is ignored, and polling continues with the next job.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortPollScheduler
+ * @see com.fazecast.jSerialComm.SerialPortPollJob
+ */
+public interface SerialPortPollListener
+{
+	/**
+	 * Called whenever a poll has received its matching response.
+	 *
+	 * @param job The poll job that was carried out.
+	 * @param response The complete response frame.
+	 */
+	void pollCompleted(SerialPortPollJob job, byte[] response);
+
+	/**
+	 * Called whenever a poll has failed after all of its retries have been exhausted.
+	 *
+	 * @param job The poll job that was carried out.
+	 * @param cause The reason for the final failure, such as a {@link SerialPortTimeoutException}.
+	 */
+	void pollFailed(SerialPortPollJob job, Exception cause);
+}
@@ -0,0 +1,344 @@
+/*
+ * SerialPortPollScheduler.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ExecutionException;
+
+/**
+ * This class schedules periodic polls of the slaves on a shared multidrop bus, such as RS-485.
+ * <p>
+ * Each {@link SerialPortPollJob} is sent using {@link SerialPort#transact(byte[], SerialPortResponseMatcher, int)}, so response framing, matching,
+ * and timeouts are all handled by the serial port's internal event thread. Polls are carried out one at a time on a single polling thread. Whenever
+ * the bus becomes free, the released job with the earliest deadline is sent next, which meets every deadline whenever the total bus load allows it.
+ * Jobs with identical deadlines are ordered by priority, and if the bus is overloaded, overdue jobs are served strictly in priority order so that
+ * only the least important polls are delayed. Idle time is only inserted when no job has been released.
+ * <p>
+ * Consecutive polls are separated by at least the RS-485 delay-after-send configured using
+ * {@link SerialPort#setRs485ModeParameters(boolean, boolean, boolean, boolean, int, int)}, giving each slave time to release the bus before the
+ * next request is transmitted. Attempts that time out or fail are retried immediately up to the configured number of retries, and latency, timeout,
+ * retry, and deadline miss statistics are maintained for every slave address.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortPollJob
+ * @see com.fazecast.jSerialComm.SerialPortPollListener
+ * @see com.fazecast.jSerialComm.SerialPortPollStatistics
+ */
+public final class SerialPortPollScheduler
+{
+	// Scheduler configuration and state
+	private final SerialPort comPort;
+	private final SerialPortResponseMatcher responseMatcher;
+	private final SerialPortPollListener pollListener;
+	private final List<SerialPortPollJob> pollJobs = new ArrayList<SerialPortPollJob>();
+	private final Map<Integer, long[]> slaveCounters = new HashMap<Integer, long[]>();
+	private volatile int responseTimeout = 1000, maxRetries = 2;
+	private volatile boolean running = false;
+	private long busReleaseTimestamp = 0;
+	private Thread pollingThread = null;
+
+	/**
+	 * Constructs a new poll scheduler for the specified serial port.
+	 *
+	 * @param serialPort The opened serial port connected to the multidrop bus.
+	 * @param matcher The {@link SerialPortResponseMatcher} used to frame and match each response.
+	 * @param listener The {@link SerialPortPollListener} to notify of each poll result.
+	 */
+	public SerialPortPollScheduler(SerialPort serialPort, SerialPortResponseMatcher matcher, SerialPortPollListener listener)
+	{
+		comPort = serialPort;
+		responseMatcher = matcher;
+		pollListener = listener;
+	}
+
+	/**
+	 * Sets the number of milliseconds to wait for each response.
+	 *
+	 * @param responseTimeout The response timeout in milliseconds.
+	 */
+	public final void setResponseTimeout(int responseTimeout) { this.responseTimeout = Math.max(responseTimeout, 1); }
+
+	/**
+	 * Returns the number of milliseconds to wait for each response.
+	 *
+	 * @return The response timeout in milliseconds.
+	 */
+	public final int getResponseTimeout() { return responseTimeout; }
+
+	/**
+	 * Sets the number of times a failed poll attempt is retried before the poll is reported as failed.
+	 *
+	 * @param maxRetries The maximum number of retries per poll.
+	 */
+	public final void setMaxRetries(int maxRetries) { this.maxRetries = Math.max(maxRetries, 0); }
+
+	/**
+	 * Returns the number of times a failed poll attempt is retried before the poll is reported as failed.
+	 *
+	 * @return The maximum number of retries per poll.
+	 */
+	public final int getMaxRetries() { return maxRetries; }
+
+	/**
+	 * Adds a periodic poll job to this scheduler. The job is released immediately and then once per period.
+	 *
+	 * @param job The poll job to add.
+	 * @return Whether the job was added, or false if it was already scheduled.
+	 */
+	public final boolean addJob(SerialPortPollJob job)
+	{
+		synchronized (pollJobs)
+		{
+			if (pollJobs.contains(job))
+				return false;
+			job.nextReleaseNanos = System.nanoTime();
+			pollJobs.add(job);
+			pollJobs.notifyAll();
+			return true;
+		}
+	}
+
+	/**
+	 * Removes a periodic poll job from this scheduler. A poll of this job that is already in progress will still complete.
+	 *
+	 * @param job The poll job to remove.
+	 * @return Whether the job was scheduled.
+	 */
+	public final boolean removeJob(SerialPortPollJob job)
+	{
+		synchronized (pollJobs) { return pollJobs.remove(job); }
+	}
+
+	/**
+	 * Returns a snapshot of the polling statistics for the specified slave address.
+	 *
+	 * @param address The slave address.
+	 * @return The polling statistics of the slave, or null if the slave has not yet been polled.
+	 */
+	public final SerialPortPollStatistics getStatistics(int address)
+	{
+		synchronized (slaveCounters)
+		{
+			long[] counters = slaveCounters.get(address);
+			return (counters != null) ? new SerialPortPollStatistics(address, counters) : null;
+		}
+	}
+
+	/**
+	 * Returns whether this scheduler is currently polling.
+	 *
+	 * @return Whether the polling thread is running.
+	 */
+	public final boolean isRunning() { return running; }
+
+	/**
+	 * Starts polling in a background thread created by the {@link SerialPortThreadFactory}.
+	 *
+	 * @return Whether the polling thread was started, or false if it was already running.
+	 */
+	public final synchronized boolean start()
+	{
+		if (running)
+			return false;
+		running = true;
+		pollingThread = SerialPortThreadFactory.get().newThread(new Runnable()
+		{
+			@Override
+			public void run()
+			{
+				SerialPortPollJob job;
+				try
+				{
+					while ((job = getNextJob()) != null)
+						poll(job);
+				}
+				finally { running = false; }
+			}
+		});
+		pollingThread.start();
+		return true;
+	}
+
+	/**
+	 * Stops polling and waits for any poll that is in progress to complete.
+	 */
+	public final synchronized void stop()
+	{
+		running = false;
+		synchronized (pollJobs) { pollJobs.notifyAll(); }
+		try
+		{
+			if ((pollingThread != null) && !Thread.currentThread().equals(pollingThread))
+				pollingThread.join();
+		}
+		catch (InterruptedException e) { Thread.currentThread().interrupt(); }
+		pollingThread = null;
+	}
+
+	private SerialPortPollJob getNextJob()
+	{
+		synchronized (pollJobs)
+		{
+			while (running)
+			{
+				// Select the released job with the earliest deadline, preferring overdue jobs in order of priority
+				long now = System.nanoTime(), nextRelease = Long.MAX_VALUE;
+				SerialPortPollJob selectedJob = null;
+				boolean selectedOverdue = false;
+				for (SerialPortPollJob job : pollJobs)
+				{
+					if (job.nextReleaseNanos > now)
+					{
+						nextRelease = Math.min(nextRelease, job.nextReleaseNanos);
+						continue;
+					}
+					boolean overdue = (job.nextReleaseNanos + job.getPeriodNanos()) <= now;
+					if ((selectedJob == null) || isPreferred(job, overdue, selectedJob, selectedOverdue))
+					{
+						selectedJob = job;
+						selectedOverdue = overdue;
+					}
+				}
+				if (selectedJob != null)
+					return selectedJob;
+
+				// Sleep until the next job is released or the set of jobs changes
+				try
+				{
+					if (nextRelease == Long.MAX_VALUE)
+						pollJobs.wait();
+					else
+						pollJobs.wait((nextRelease - now) / 1000000L, (int)((nextRelease - now) % 1000000L));
+				}
+				catch (InterruptedException e)
+				{
+					Thread.currentThread().interrupt();
+					running = false;
+				}
+			}
+			return null;
+		}
+	}
+
+	private boolean isPreferred(SerialPortPollJob job, boolean overdue, SerialPortPollJob selectedJob, boolean selectedOverdue)
+	{
+		long deadline = job.nextReleaseNanos + job.getPeriodNanos(), selectedDeadline = selectedJob.nextReleaseNanos + selectedJob.getPeriodNanos();
+		if (overdue != selectedOverdue)
+			return overdue;
+		else if (overdue && (job.getPriority() != selectedJob.getPriority()))
+			return job.getPriority() > selectedJob.getPriority();
+		else if (deadline != selectedDeadline)
+			return deadline < selectedDeadline;
+		return job.getPriority() > selectedJob.getPriority();
+	}
+
+	private void poll(SerialPortPollJob job)
+	{
+		// Attempt the poll, retrying after any timeout or failure from this thread rather than natively, since each attempt is a complete transaction whose framing, matching, and timeout are handled by the event thread
+		long release = job.nextReleaseNanos, period = job.getPeriodNanos(), latency = -1, timeouts = 0, retries = 0;
+		byte[] response = null;
+		Exception failure = null;
+		for (int attempt = 0; (attempt <= maxRetries) && ((attempt == 0) || running); ++attempt)
+		{
+			// Give the previously addressed slave time to release the bus
+			long turnaroundRemaining = (busReleaseTimestamp + (comPort.getRs485DelayAfter() * 1000L)) - System.nanoTime();
+			if (turnaroundRemaining > 0)
+				try { Thread.sleep(turnaroundRemaining / 1000000L, (int)(turnaroundRemaining % 1000000L)); } catch (InterruptedException e) { Thread.currentThread().interrupt(); }
+			if (attempt > 0)
+				++retries;
+
+			// Carry out a single request/response transaction
+			SerialPortTransaction transaction = comPort.transact(job.getRequestBytes(), responseMatcher, responseTimeout);
+			try
+			{
+				response = transaction.get();
+				latency = transaction.getResponseTimestamp() - transaction.getRequestTimestamp();
+				failure = null;
+			}
+			catch (ExecutionException e)
+			{
+				failure = (e.getCause() instanceof Exception) ? (Exception)e.getCause() : e;
+				if (failure instanceof SerialPortTimeoutException)
+					++timeouts;
+			}
+			catch (InterruptedException e)
+			{
+				transaction.cancel(false);
+				Thread.currentThread().interrupt();
+				failure = e;
+				running = false;
+			}
+			busReleaseTimestamp = System.nanoTime();
+			if (failure == null)
+				break;
+		}
+
+		// Schedule the next release at a fixed rate, skipping any releases that can no longer be served
+		long now = System.nanoTime(), deadlineMisses = ((release + period) < now) ? 1 : 0;
+		synchronized (pollJobs)
+		{
+			job.nextReleaseNanos = release + period;
+			if ((job.nextReleaseNanos + period) <= now)
+			{
+				long skippedReleases = (now - job.nextReleaseNanos) / period;
+				job.nextReleaseNanos += skippedReleases * period;
+				deadlineMisses += skippedReleases;
+			}
+		}
+
+		// Update the statistics for the polled slave
+		synchronized (slaveCounters)
+		{
+			long[] counters = slaveCounters.get(job.getAddress());
+			if (counters == null)
+				slaveCounters.put(job.getAddress(), counters = new long[9]);
+			++counters[0];
+			counters[1] += (failure == null) ? 1 : 0;
+			counters[2] += timeouts;
+			counters[3] += (failure != null) ? 1 : 0;
+			counters[4] += retries;
+			counters[5] += deadlineMisses;
+			if (latency >= 0)
+			{
+				counters[6] = (counters[1] == 1) ? latency : Math.min(counters[6], latency);
+				counters[7] = Math.max(counters[7], latency);
+				counters[8] += latency;
+			}
+		}
+
+		// Notify the listener of the result, making sure that an exception in its callback cannot stop the polling of other jobs
+		try
+		{
+			if (failure == null)
+				pollListener.pollCompleted(job, response);
+			else
+				pollListener.pollFailed(job, failure);
+		}
+		catch (RuntimeException e) {}
+	}
+}
@@ -0,0 +1,126 @@
+/*
+ * SerialPortPollStatistics.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class contains a snapshot of the polling statistics of a single slave served by a {@link SerialPortPollScheduler}.
+ * <p>
+ * Latencies are measured from the moment a request finished being written until the final byte of its response arrived, and only include
+ * successful attempts. A deadline miss is counted whenever a poll completes after the start of its following period, and once for every
+ * release that had to be skipped because the bus was overloaded.
+ *
+ * @see SerialPortPollScheduler#getStatistics(int)
+ */
+public final class SerialPortPollStatistics
+{
+	private final int address;
+	private final long polls, responses, timeouts, failures, retries, deadlineMisses;
+	private final long minimumLatency, maximumLatency, totalLatency;
+
+	SerialPortPollStatistics(int slaveAddress, long[] counters)
+	{
+		address = slaveAddress;
+		polls = counters[0];
+		responses = counters[1];
+		timeouts = counters[2];
+		failures = counters[3];
+		retries = counters[4];
+		deadlineMisses = counters[5];
+		minimumLatency = counters[6];
+		maximumLatency = counters[7];
+		totalLatency = counters[8];
+	}
+
+	/**
+	 * Returns the address of the slave described by this snapshot.
+	 *
+	 * @return The slave address.
+	 */
+	public final int getAddress() { return address; }
+
+	/**
+	 * Returns the number of polls carried out for this slave, not including retries.
+	 *
+	 * @return The number of polls.
+	 */
+	public final long getPollCount() { return polls; }
+
+	/**
+	 * Returns the number of polls that received a matching response, possibly after one or more retries.
+	 *
+	 * @return The number of successful polls.
+	 */
+	public final long getResponseCount() { return responses; }
+
+	/**
+	 * Returns the number of individual attempts that did not receive a matching response within the response timeout.
+	 *
+	 * @return The number of timed-out attempts.
+	 */
+	public final long getTimeoutCount() { return timeouts; }
+
+	/**
+	 * Returns the number of polls that failed after all of their retries were exhausted.
+	 *
+	 * @return The number of failed polls.
+	 */
+	public final long getFailureCount() { return failures; }
+
+	/**
+	 * Returns the number of retries carried out for this slave.
+	 *
+	 * @return The number of retries.
+	 */
+	public final long getRetryCount() { return retries; }
+
+	/**
+	 * Returns the number of poll deadlines that were missed for this slave.
+	 *
+	 * @return The number of deadline misses.
+	 */
+	public final long getDeadlineMissCount() { return deadlineMisses; }
+
+	/**
+	 * Returns the shortest response latency observed for this slave.
+	 *
+	 * @return The minimum latency in nanoseconds, or 0 if no responses have been received.
+	 */
+	public final long getMinimumLatencyNanos() { return minimumLatency; }
+
+	/**
+	 * Returns the longest response latency observed for this slave.
+	 *
+	 * @return The maximum latency in nanoseconds, or 0 if no responses have been received.
+	 */
+	public final long getMaximumLatencyNanos() { return maximumLatency; }
+
+	/**
+	 * Returns the mean response latency observed for this slave.
+	 *
+	 * @return The average latency in nanoseconds, or 0 if no responses have been received.
+	 */
+	public final long getAverageLatencyNanos() { return (responses == 0) ? 0 : (totalLatency / responses); }
+}
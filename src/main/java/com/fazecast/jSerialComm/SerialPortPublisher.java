@@ -0,0 +1,203 @@
+/*
+ * SerialPortPublisher.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.concurrent.locks.Condition;
+import java.util.concurrent.locks.ReentrantLock;
+
+/**
+ * This class publishes the data received by a serial port to a single {@link SerialPortSubscriber} according to the subscriber's demand.
+ * <p>
+ * It mirrors the <code>java.util.concurrent.Flow.Publisher&lt;ByteBuffer&gt;</code> interface available in newer versions of Java. Whenever the
+ * subscriber has no outstanding demand, the serial port will not be read. If the port is configured for {@link SerialPort#FLOW_CONTROL_XONXOFF_IN_ENABLED}
+ * flow control, an XOFF character will additionally be sent as soon as demand runs out, and an XON character once more data has been requested.
+ * With {@link SerialPort#FLOW_CONTROL_RTS_ENABLED} flow control, the driver itself de-asserts RTS once its receive buffer fills up.
+ * <p>
+ * A publisher registers itself as a data listener of its serial port while it has an active subscriber. Since data is not read from the serial
+ * port while the subscriber has no outstanding demand, any other {@link SerialPortDataListener}s registered with the same port will be paused as well.
+ *
+ * @see SerialPort#getDataPublisher()
+ * @see SerialPortSubscriber
+ * @see SerialPortSubscription
+ */
+public final class SerialPortPublisher
+{
+	private final SerialPort comPort;
+
+	SerialPortPublisher(SerialPort serialPort) { comPort = serialPort; }
+
+	/**
+	 * Subscribes the specified {@link SerialPortSubscriber} to the data received by this publisher's serial port.
+	 * <p>
+	 * The {@link SerialPortSubscriber#onError(Throwable)} method will be called immediately if the subscription could not be registered
+	 * with the serial port.
+	 *
+	 * @param subscriber The subscriber to which received data should be delivered.
+	 */
+	public final void subscribe(SerialPortSubscriber subscriber)
+	{
+		PublisherSubscription subscription = new PublisherSubscription(subscriber);
+		subscriber.onSubscribe(subscription);
+		subscription.register();
+	}
+
+	// Private class linking the serial port data listener to a subscriber
+	private final class PublisherSubscription implements SerialPortSubscription, SerialPortDataBufferListener, SerialPortDataListenerWithExceptions
+	{
+		private final SerialPortSubscriber subscriber;
+		private final ReentrantLock demandLock = new ReentrantLock(), throttleLock = new ReentrantLock();
+		private final Condition demandAvailable = demandLock.newCondition();
+		private long demand = 0;
+		private boolean isFinished = false, isRegistered = false, isThrottled = false;
+
+		public PublisherSubscription(SerialPortSubscriber dataSubscriber) { subscriber = dataSubscriber; }
+
+		public final void register()
+		{
+			demandLock.lock();
+			try
+			{
+				if (isFinished)
+					return;
+				isRegistered = comPort.addDataListener(this);
+			}
+			finally { demandLock.unlock(); }
+			if (!isRegistered)
+				fail(new IllegalStateException("Unable to register a data listener with this serial port."));
+		}
+
+		@Override
+		public void request(long n)
+		{
+			if (n <= 0)
+			{
+				fail(new IllegalArgumentException("The number of requested data buffers must be positive."));
+				return;
+			}
+			demandLock.lock();
+			try
+			{
+				if (isFinished)
+					return;
+				demand = ((Long.MAX_VALUE - demand) < n) ? Long.MAX_VALUE : (demand + n);
+				demandAvailable.signalAll();
+			}
+			finally { demandLock.unlock(); }
+			updateThrottle();
+		}
+
+		@Override
+		public void cancel() { finish(); }
+
+		@Override
+		public int getListeningEvents() { return SerialPort.LISTENING_EVENT_DATA_RECEIVED | SerialPort.LISTENING_EVENT_PORT_DISCONNECTED; }
+
+		@Override
+		public void serialEvent(SerialPortEvent event)
+		{
+			if (event.getEventType() == SerialPort.LISTENING_EVENT_PORT_DISCONNECTED)
+			{
+				if (finish())
+					subscriber.onComplete();
+			}
+		}
+
+		@Override
+		public void serialDataReceived(SerialPortEvent event, byte[] data, int offset, int length)
+		{
+			// Throttle the device and block the reading thread until the subscriber has requested more data
+			updateThrottle();
+			demandLock.lock();
+			try
+			{
+				while ((demand == 0) && !isFinished)
+				{
+					try { demandAvailable.await(); }
+					catch (InterruptedException e) { Thread.currentThread().interrupt(); return; }
+				}
+				if (isFinished)
+					return;
+				if (demand != Long.MAX_VALUE)
+					--demand;
+			}
+			finally { demandLock.unlock(); }
+
+			// Deliver a private copy of the data and throttle the device immediately if demand has run out
+			subscriber.onNext(ByteBuffer.wrap(Arrays.copyOfRange(data, offset, offset + length)).asReadOnlyBuffer());
+			updateThrottle();
+		}
+
+		@Override
+		public void catchException(Exception e) { fail(e); }
+
+		private void fail(Throwable throwable)
+		{
+			if (finish())
+				subscriber.onError(throwable);
+		}
+
+		private boolean finish()
+		{
+			// Release any blocked reading thread before unregistering from the serial port
+			boolean wasRegistered;
+			demandLock.lock();
+			try
+			{
+				if (isFinished)
+					return false;
+				isFinished = true;
+				wasRegistered = isRegistered;
+				demandAvailable.signalAll();
+			}
+			finally { demandLock.unlock(); }
+			updateThrottle();
+			if (wasRegistered)
+				comPort.removeDataListener(this);
+			return true;
+		}
+
+		private void updateThrottle()
+		{
+			// Apply the current demand state outside of the demand lock, serializing updates so that the most recent state is always the last one written
+			throttleLock.lock();
+			try
+			{
+				boolean throttled;
+				demandLock.lock();
+				try { throttled = (demand == 0) && !isFinished; }
+				finally { demandLock.unlock(); }
+				if (throttled != isThrottled)
+				{
+					isThrottled = throttled;
+					comPort.throttleInput(throttled);
+				}
+			}
+			finally { throttleLock.unlock(); }
+		}
+	}
+}
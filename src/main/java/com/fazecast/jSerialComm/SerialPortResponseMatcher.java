@@ -0,0 +1,75 @@
+/*
+ * SerialPortResponseMatcher.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to match responses to the requests sent using {@link SerialPort#transact(byte[], SerialPortResponseMatcher, int)}.
+ * <p>
+ * A response matcher is registered with the serial port as a data listener the first time it is used, and the boundaries of each response are determined
+ * in exactly the same way as for any other listener: by additionally implementing one of the framing interfaces such as {@link SerialPortPacketListener},
+ * {@link SerialPortMessageListener}, {@link SerialPortLengthFieldListener}, {@link SerialPortIdleGapListener}, {@link SerialPortCobsListener},
+ * {@link SerialPortSlipListener}, or {@link SerialPortHdlcListener}, optionally combined with {@link SerialPortFrameCrcListener}. All framing is therefore
+ * carried out in native code by the internal event thread, and each received frame is matched against the outstanding transactions before it is
+ * delivered anywhere else.
+ * <p>
+ * If {@link #getCorrelationLength()} returns 0, each received frame completes the oldest outstanding transaction, and only a single transaction is
+ * outstanding at any time, as required by half-duplex links. Otherwise, each request and response carries a correlation field at the same position,
+ * such as a sequence number or transaction identifier, and up to {@link #getMaxOutstandingTransactions()} requests may be pipelined on a full-duplex
+ * link, with each response completing the outstanding transaction whose request contains an identical correlation field.
+ * <p>
+ * Frames that do not match any outstanding transaction are delivered to the {@link #serialEvent(SerialPortEvent)} callback as unsolicited
+ * {@link SerialPort#LISTENING_EVENT_DATA_RECEIVED} events, which are always enabled for response matchers.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortTransaction
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortResponseMatcher extends SerialPortDataListener
+{
+	/**
+	 * Must be overridden to return the byte offset of the correlation field within both requests and responses.
+	 *
+	 * @return The offset of the correlation field.
+	 */
+	int getCorrelationOffset();
+
+	/**
+	 * Must be overridden to return the length of the correlation field in bytes, or 0 if responses are matched to requests in the order in which
+	 * they were sent.
+	 *
+	 * @return The length of the correlation field.
+	 */
+	int getCorrelationLength();
+
+	/**
+	 * Must be overridden to return the maximum number of transactions that may be outstanding at the same time.
+	 * <p>
+	 * This value is ignored if {@link #getCorrelationLength()} returns 0, in which case transactions are always carried out one at a time.
+	 *
+	 * @return The maximum pipelining depth.
+	 */
+	int getMaxOutstandingTransactions();
+}
@@ -0,0 +1,137 @@
+/*
+ * SerialPortRs485Statistics.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This class contains a snapshot of the bus turnaround timing measured by software RS-485 direction control.
+ * <p>
+ * When software direction control is enabled using {@link SerialPort#setRs485SoftwareDirectionControl(boolean)}, every write asserts RTS,
+ * waits for the final stop bit to leave the transmitter, and then releases RTS after the configured delay-after-send. Two histograms are
+ * maintained for every such transmission:
+ * <ul>
+ *   <li>The <i>turnaround</i> histogram records the time from the detected end of transmission until RTS was actually released, which should
+ *       closely match the delay-after-send passed to {@link SerialPort#setRs485ModeParameters(boolean, boolean, boolean, boolean, int, int)}.</li>
+ *   <li>The <i>end-of-transmission latency</i> histogram records how long after the earliest possible end of transmission, as calculated from
+ *       the baud rate and the number of written characters, the end of transmission was detected.</li>
+ * </ul>
+ * Each histogram contains {@link #HISTOGRAM_BUCKETS} buckets. Bucket 0 counts durations below one microsecond, and every subsequent bucket
+ * <i>n</i> counts durations of at least 2<sup>n-1</sup> but less than 2<sup>n</sup> microseconds, except for the final bucket which counts all
+ * longer durations.
+ *
+ * @see SerialPort#getRs485Statistics()
+ */
+public final class SerialPortRs485Statistics
+{
+	/**
+	 * The number of buckets in each timing histogram.
+	 */
+	static final public int HISTOGRAM_BUCKETS = 20;
+
+	private final long timestamp, transmissions, hardwareConfirmedTransmissions, maximumTurnaround, maximumEndOfTransmissionLatency;
+	private final long[] turnaroundHistogram = new long[HISTOGRAM_BUCKETS], endOfTransmissionLatencyHistogram = new long[HISTOGRAM_BUCKETS];
+	private final boolean softwareControlActive;
+
+	SerialPortRs485Statistics(long[] counters, boolean softwareDirectionControlActive, long timestampNanos)
+	{
+		transmissions = counters[0];
+		hardwareConfirmedTransmissions = counters[1];
+		maximumTurnaround = counters[2];
+		maximumEndOfTransmissionLatency = counters[3];
+		System.arraycopy(counters, 4, turnaroundHistogram, 0, HISTOGRAM_BUCKETS);
+		System.arraycopy(counters, 4 + HISTOGRAM_BUCKETS, endOfTransmissionLatencyHistogram, 0, HISTOGRAM_BUCKETS);
+		softwareControlActive = softwareDirectionControlActive;
+		timestamp = timestampNanos;
+	}
+
+	/**
+	 * Returns the exclusive upper limit of the specified histogram bucket.
+	 *
+	 * @param bucket The index of the histogram bucket.
+	 * @return The upper limit of the bucket in microseconds, or {@link Long#MAX_VALUE} for the final bucket.
+	 */
+	public static long getBucketLimitMicroseconds(int bucket) { return (bucket < (HISTOGRAM_BUCKETS - 1)) ? (1L << bucket) : Long.MAX_VALUE; }
+
+	/**
+	 * Returns the time at which this snapshot was taken, as reported by {@link System#nanoTime()}.
+	 *
+	 * @return The time in nanoseconds at which this snapshot was taken.
+	 */
+	public final long getTimestampNanos() { return timestamp; }
+
+	/**
+	 * Returns whether software RS-485 direction control was active for the port when this snapshot was taken.
+	 *
+	 * @return Whether software direction control is active.
+	 */
+	public final boolean isSoftwareDirectionControlActive() { return softwareControlActive; }
+
+	/**
+	 * Returns the number of transmissions carried out using software direction control since the port was opened.
+	 *
+	 * @return The number of transmissions.
+	 */
+	public final long getTransmissionCount() { return transmissions; }
+
+	/**
+	 * Returns the number of transmissions whose end was confirmed by polling the transmitter empty flag of the UART line status register.
+	 * <p>
+	 * The end of all remaining transmissions was determined from the driver's output queue and the configured baud rate. Line status polling
+	 * is only available on Linux for drivers that support the <i>TIOCSERGETLSR</i> request.
+	 *
+	 * @return The number of hardware-confirmed transmissions.
+	 */
+	public final long getHardwareConfirmedTransmissionCount() { return hardwareConfirmedTransmissions; }
+
+	/**
+	 * Returns the longest measured time from the end of a transmission until the release of RTS.
+	 *
+	 * @return The maximum bus turnaround time in nanoseconds.
+	 */
+	public final long getMaximumTurnaroundNanos() { return maximumTurnaround; }
+
+	/**
+	 * Returns the longest measured delay between the earliest possible end of a transmission and its detection.
+	 *
+	 * @return The maximum end-of-transmission latency in nanoseconds.
+	 */
+	public final long getMaximumEndOfTransmissionLatencyNanos() { return maximumEndOfTransmissionLatency; }
+
+	/**
+	 * Returns a copy of the histogram of times from the end of each transmission until the release of RTS.
+	 *
+	 * @return The bus turnaround histogram.
+	 * @see #getBucketLimitMicroseconds(int)
+	 */
+	public final long[] getTurnaroundHistogram() { return turnaroundHistogram.clone(); }
+
+	/**
+	 * Returns a copy of the histogram of delays between the earliest possible end of each transmission and its detection.
+	 *
+	 * @return The end-of-transmission latency histogram.
+	 * @see #getBucketLimitMicroseconds(int)
+	 */
+	public final long[] getEndOfTransmissionLatencyHistogram() { return endOfTransmissionLatencyHistogram.clone(); }
+}
@@ -0,0 +1,66 @@
+/*
+ * SerialPortSubscriber.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.nio.ByteBuffer;
+
+/**
+ * This interface must be implemented to receive data from a {@link SerialPortPublisher}.
+ * <p>
+ * It mirrors the <code>java.util.concurrent.Flow.Subscriber&lt;ByteBuffer&gt;</code> interface available in newer versions of Java,
+ * allowing it to be trivially adapted to that interface or to any other Reactive Streams implementation.
+ *
+ * @see SerialPortPublisher
+ * @see SerialPortSubscription
+ */
+public interface SerialPortSubscriber
+{
+	/**
+	 * Called once before any other method to provide the {@link SerialPortSubscription} used to request data.
+	 *
+	 * @param subscription The subscription linking this subscriber to its publisher.
+	 */
+	void onSubscribe(SerialPortSubscription subscription);
+
+	/**
+	 * Called with each chunk of data received from the serial port, at most as many times as have been requested.
+	 *
+	 * @param data A read-only buffer containing the received bytes, which the subscriber may retain.
+	 */
+	void onNext(ByteBuffer data);
+
+	/**
+	 * Called once if the subscription fails, after which no other methods will be called.
+	 *
+	 * @param throwable The error that caused the subscription to fail.
+	 */
+	void onError(Throwable throwable);
+
+	/**
+	 * Called once when the serial port has been disconnected, after which no other methods will be called.
+	 */
+	void onComplete();
+}
@@ -0,0 +1,51 @@
+/*
+ * SerialPortSubscription.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface represents the link between a {@link SerialPortPublisher} and its {@link SerialPortSubscriber}.
+ * <p>
+ * It mirrors the <code>java.util.concurrent.Flow.Subscription</code> interface available in newer versions of Java.
+ *
+ * @see SerialPortPublisher
+ * @see SerialPortSubscriber
+ */
+public interface SerialPortSubscription
+{
+	/**
+	 * Adds the specified number of data buffers to the outstanding demand of the subscriber.
+	 * <p>
+	 * No data will be read from the serial port while there is no outstanding demand.
+	 *
+	 * @param n The number of additional data buffers requested, which must be positive.
+	 */
+	void request(long n);
+
+	/**
+	 * Stops the delivery of data to the subscriber and unregisters the publisher from its serial port.
+	 */
+	void cancel();
+}
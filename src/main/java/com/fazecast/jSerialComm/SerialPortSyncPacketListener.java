@@ -0,0 +1,53 @@
+/*
+ * SerialPortSyncPacketListener.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+/**
+ * This interface must be implemented to enable full packet reads of packets that always begin with a fixed synchronization word.
+ * <p>
+ * Packets are framed in the same manner as for a standard {@link SerialPortPacketListener}; however, each packet must begin with the bytes returned by
+ * {@link #getPacketSyncWord()}. Whenever a packet boundary does not contain the synchronization word, for example after a byte was lost or when
+ * listening begins in the middle of a packet, all received data up to the next occurrence of the synchronization word will be discarded so that
+ * packet framing is automatically resynchronized with the data stream. The search for the synchronization word is carried out in native code.
+ * <p>
+ * <i>Note</i>: Using this interface will negate any serial port read timeout settings since they make no sense in an asynchronous context.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortPacketListener
+ * @see com.fazecast.jSerialComm.SerialPortDataListener
+ * @see java.util.EventListener
+ */
+public interface SerialPortSyncPacketListener extends SerialPortPacketListener
+{
+	/**
+	 * Must be overridden to return the synchronization word with which every packet begins.
+	 * <p>
+	 * The synchronization word is counted as part of the packet and is included in the packet data passed to the listener. It must not be longer than
+	 * the packet size returned by {@link #getPacketSize()}. If an empty array is returned, no resynchronization will take place.
+	 *
+	 * @return A byte array containing the synchronization word that must be present at the start of every packet.
+	 */
+	byte[] getPacketSyncWord();
+}
@@ -0,0 +1,159 @@
+/*
+ * SerialPortTransaction.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.TimeoutException;
+
+/**
+ * This class represents a single request/response transaction started using {@link SerialPort#transact(byte[], SerialPortResponseMatcher, int)}.
+ * <p>
+ * A transaction is completed by the internal event thread as soon as its response has been framed and matched, so the result of this future may be
+ * retrieved without any further reads of the serial port. If no matching response arrives within the transaction timeout, the transaction completes
+ * with an {@link ExecutionException} caused by a {@link SerialPortTimeoutException}, and if the request could not be written or the response
+ * matcher was removed from the serial port, it completes with an {@link ExecutionException} caused by a {@link SerialPortIOException}.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortResponseMatcher
+ * @see java.util.concurrent.Future
+ */
+public final class SerialPortTransaction implements Future<byte[]>
+{
+	private final byte[] request;
+	private final int timeout;
+	private final CountDownLatch completion = new CountDownLatch(1);
+	private volatile byte[] response = null;
+	private volatile Exception failure = null;
+	private volatile boolean cancelled = false;
+	private volatile long requestTimestamp = 0, responseTimestamp = 0;
+	private volatile Future<?> timeoutTask = null;
+	private volatile SerialPortTransactionQueue transactionQueue = null;
+
+	// Constructs a new transaction for the specified request
+	SerialPortTransaction(byte[] request, int timeout)
+	{
+		this.request = request;
+		this.timeout = timeout;
+	}
+
+	/**
+	 * Returns the request sent by this transaction.
+	 *
+	 * @return A copy of the request bytes.
+	 */
+	public final byte[] getRequest() { return request.clone(); }
+
+	/**
+	 * Returns the number of milliseconds after the request was written to wait for a matching response.
+	 *
+	 * @return The transaction timeout in milliseconds.
+	 */
+	public final int getTimeout() { return timeout; }
+
+	/**
+	 * Returns the monotonic time at which the request finished being written to the serial port.
+	 *
+	 * @return The request timestamp in nanoseconds, comparable with {@link System#nanoTime()}, or 0 if the request has not yet been written.
+	 */
+	public final long getRequestTimestamp() { return requestTimestamp; }
+
+	/**
+	 * Returns the monotonic arrival time of the final byte of the matching response.
+	 *
+	 * @return The response timestamp in nanoseconds, comparable with {@link System#nanoTime()}, or 0 if no response has been received.
+	 */
+	public final long getResponseTimestamp() { return responseTimestamp; }
+
+	@Override
+	public final boolean cancel(boolean mayInterruptIfRunning)
+	{
+		SerialPortTransactionQueue queue = transactionQueue;
+		return ((queue == null) || queue.removeTransaction(this)) && finish(null, 0, null, true);
+	}
+
+	@Override
+	public final boolean isCancelled() { return cancelled; }
+
+	@Override
+	public final boolean isDone() { return completion.getCount() == 0; }
+
+	@Override
+	public final byte[] get() throws InterruptedException, ExecutionException
+	{
+		completion.await();
+		return getResult();
+	}
+
+	@Override
+	public final byte[] get(long timeout, TimeUnit unit) throws InterruptedException, ExecutionException, TimeoutException
+	{
+		if (!completion.await(timeout, unit))
+			throw new TimeoutException("The transaction has not yet completed");
+		return getResult();
+	}
+
+	// Package-private methods used by the transaction queue to track and complete this transaction
+	final byte[] getRequestBytes() { return request; }
+	final void setTransactionQueue(SerialPortTransactionQueue queue) { transactionQueue = queue; }
+	final void setRequestTimestamp(long timestamp) { requestTimestamp = timestamp; }
+	final synchronized void setTimeoutTask(Future<?> task)
+	{
+		// The response may already have arrived while the request was still being written, in which case the timeout is no longer needed
+		if (completion.getCount() == 0)
+			task.cancel(false);
+		else
+			timeoutTask = task;
+	}
+	final boolean complete(byte[] responseData, long timestamp) { return finish(responseData, timestamp, null, false); }
+	final boolean fail(Exception exception) { return finish(null, 0, exception, false); }
+
+	private synchronized boolean finish(byte[] responseData, long timestamp, Exception exception, boolean cancel)
+	{
+		if (completion.getCount() == 0)
+			return false;
+		cancelled = cancel;
+		response = responseData;
+		responseTimestamp = timestamp;
+		failure = exception;
+		Future<?> task = timeoutTask;
+		if (task != null)
+			task.cancel(false);
+		completion.countDown();
+		return true;
+	}
+
+	private byte[] getResult() throws ExecutionException
+	{
+		if (cancelled)
+			throw new CancellationException("The transaction was cancelled");
+		else if (failure != null)
+			throw new ExecutionException(failure);
+		return response;
+	}
+}
@@ -0,0 +1,244 @@
+/*
+ * SerialPortTransactionQueue.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.LinkedList;
+import java.util.concurrent.ScheduledFuture;
+import java.util.concurrent.ScheduledThreadPoolExecutor;
+import java.util.concurrent.SynchronousQueue;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * This package-private class tracks the outstanding and waiting transactions of a single {@link SerialPortResponseMatcher}.
+ * <p>
+ * Requests are written as soon as the pipelining depth allows, and each framed response is matched against the outstanding transactions on the
+ * internal event thread. The next waiting request is written before the matched transaction is completed, so the turnaround between a response
+ * and the following request does not depend on how quickly the application processes the response. Requests are always written outside of the
+ * queue lock, and requests started because another transaction timed out are handed to a separate writer thread so that a blocking write can
+ * never delay the timeouts of other transactions.
+ */
+final class SerialPortTransactionQueue
+{
+	// Shared executors for transaction timeouts and for the requests started by them, whose threads exit whenever they are idle
+	static private final int TIMEOUT_PURGE_INTERVAL = 256;
+	static private ScheduledThreadPoolExecutor timeoutExecutor = null;
+	static private int numTimeoutsScheduled = 0;
+	static private ThreadPoolExecutor requestWriteExecutor = null;
+
+	// Transaction queue state
+	private final SerialPort comPort;
+	private final int correlationOffset, correlationLength, maxOutstandingTransactions;
+	private final LinkedList<SerialPortTransaction> outstandingTransactions = new LinkedList<SerialPortTransaction>(), waitingTransactions = new LinkedList<SerialPortTransaction>();
+	private final Object requestWriteLock = new Object();
+
+	public SerialPortTransactionQueue(SerialPort serialPort, SerialPortResponseMatcher matcher)
+	{
+		comPort = serialPort;
+		correlationOffset = Math.max(matcher.getCorrelationOffset(), 0);
+		correlationLength = Math.max(matcher.getCorrelationLength(), 0);
+		maxOutstandingTransactions = (correlationLength > 0) ? Math.max(matcher.getMaxOutstandingTransactions(), 1) : 1;
+	}
+
+	// Writes the transaction request immediately if the pipelining depth allows it, or queues it to be written later
+	public final void submit(SerialPortTransaction transaction)
+	{
+		if (transaction.getRequestBytes().length < (correlationOffset + correlationLength))
+		{
+			transaction.fail(new SerialPortIOException("The transaction request is too short to contain its correlation field"));
+			return;
+		}
+		transaction.setTransactionQueue(this);
+		LinkedList<SerialPortTransaction> startedTransactions;
+		synchronized (this)
+		{
+			waitingTransactions.add(transaction);
+			startedTransactions = startWaitingTransactions();
+		}
+		writeRequests(startedTransactions);
+	}
+
+	// Completes the outstanding transaction matching the specified frame, returning whether a match was found
+	public final boolean completeTransaction(byte[] buffer, int offset, int length, long timestamp)
+	{
+		SerialPortTransaction matchedTransaction = null;
+		LinkedList<SerialPortTransaction> startedTransactions;
+		synchronized (this)
+		{
+			if (correlationLength == 0)
+				matchedTransaction = outstandingTransactions.poll();
+			else if (length >= (correlationOffset + correlationLength))
+				for (Iterator<SerialPortTransaction> iterator = outstandingTransactions.iterator(); iterator.hasNext(); )
+				{
+					SerialPortTransaction transaction = iterator.next();
+					if (correlationMatches(transaction.getRequestBytes(), buffer, offset))
+					{
+						iterator.remove();
+						matchedTransaction = transaction;
+						break;
+					}
+				}
+			if (matchedTransaction == null)
+				return false;
+			startedTransactions = startWaitingTransactions();
+		}
+		writeRequests(startedTransactions);
+		matchedTransaction.complete(Arrays.copyOfRange(buffer, offset, offset + length), timestamp);
+		return true;
+	}
+
+	// Removes a transaction that has not yet completed, returning whether it was found
+	public final boolean removeTransaction(SerialPortTransaction transaction)
+	{
+		LinkedList<SerialPortTransaction> startedTransactions = takeTransaction(transaction);
+		if (startedTransactions == null)
+			return false;
+		writeRequests(startedTransactions);
+		return true;
+	}
+
+	// Fails all outstanding and waiting transactions
+	public final void failTransactions(String reason)
+	{
+		LinkedList<SerialPortTransaction> failedTransactions = new LinkedList<SerialPortTransaction>();
+		synchronized (this)
+		{
+			failedTransactions.addAll(outstandingTransactions);
+			failedTransactions.addAll(waitingTransactions);
+			outstandingTransactions.clear();
+			waitingTransactions.clear();
+		}
+		for (SerialPortTransaction transaction : failedTransactions)
+			transaction.fail(new SerialPortIOException(reason));
+	}
+
+	// Removes a transaction that has not yet completed, returning the transactions started in its place or null if it was not found
+	private synchronized LinkedList<SerialPortTransaction> takeTransaction(SerialPortTransaction transaction)
+	{
+		if (!waitingTransactions.remove(transaction) && !outstandingTransactions.remove(transaction))
+			return null;
+		return startWaitingTransactions();
+	}
+
+	// Moves as many waiting transactions as the pipelining depth allows to the outstanding list, returning them so that they can be written outside of the lock
+	private LinkedList<SerialPortTransaction> startWaitingTransactions()
+	{
+		LinkedList<SerialPortTransaction> startedTransactions = new LinkedList<SerialPortTransaction>();
+		while (!waitingTransactions.isEmpty() && (outstandingTransactions.size() < maxOutstandingTransactions))
+		{
+			SerialPortTransaction transaction = waitingTransactions.poll();
+			outstandingTransactions.add(transaction);
+			startedTransactions.add(transaction);
+		}
+		return startedTransactions;
+	}
+
+	// Writes the requests of newly started transactions in order, failing any transaction whose request could not be written
+	private void writeRequests(LinkedList<SerialPortTransaction> startedTransactions)
+	{
+		SerialPortTransaction transaction;
+		while ((transaction = startedTransactions.poll()) != null)
+		{
+			// Skip transactions that were cancelled or failed before their request could be written
+			boolean writeSucceeded;
+			if (transaction.isDone())
+				continue;
+			byte[] request = transaction.getRequestBytes();
+			synchronized (requestWriteLock)
+			{
+				writeSucceeded = (comPort.writeBytes(request, request.length) == request.length);
+				if (writeSucceeded)
+					transaction.setRequestTimestamp(System.nanoTime());
+			}
+			if (writeSucceeded)
+				startTimeout(transaction);
+			if (!writeSucceeded)
+			{
+				LinkedList<SerialPortTransaction> replacementTransactions = takeTransaction(transaction);
+				if (replacementTransactions != null)
+				{
+					startedTransactions.addAll(replacementTransactions);
+					transaction.fail(new SerialPortIOException("Unable to write the transaction request to the serial port"));
+				}
+			}
+		}
+	}
+
+	// Starts the response timeout of a transaction whose request has just been written
+	private void startTimeout(final SerialPortTransaction transaction)
+	{
+		transaction.setTimeoutTask(scheduleTimeout(new Runnable()
+		{
+			@Override
+			public void run()
+			{
+				// Never write the requests started in place of the expired transaction from the shared timeout thread
+				final LinkedList<SerialPortTransaction> replacementTransactions = takeTransaction(transaction);
+				if (replacementTransactions == null)
+					return;
+				transaction.fail(new SerialPortTimeoutException("No matching response was received within the transaction timeout"));
+				if (!replacementTransactions.isEmpty())
+					getRequestWriteExecutor().execute(new Runnable()
+					{
+						@Override
+						public void run() { writeRequests(replacementTransactions); }
+					});
+			}
+		}, transaction.getTimeout()));
+	}
+
+	private boolean correlationMatches(byte[] request, byte[] buffer, int offset)
+	{
+		for (int i = 0; i < correlationLength; ++i)
+			if (request[correlationOffset + i] != buffer[offset + correlationOffset + i])
+				return false;
+		return true;
+	}
+
+	static private synchronized ScheduledFuture<?> scheduleTimeout(Runnable task, long timeoutMilliseconds)
+	{
+		if (timeoutExecutor == null)
+		{
+			timeoutExecutor = new ScheduledThreadPoolExecutor(1, SerialPortThreadFactory.get());
+			timeoutExecutor.setKeepAliveTime(1, TimeUnit.SECONDS);
+			timeoutExecutor.allowCoreThreadTimeOut(true);
+		}
+
+		// Cancelled timeouts stay queued until their delay elapses, and removing them automatically requires Java 7, so purge them periodically
+		if ((++numTimeoutsScheduled % TIMEOUT_PURGE_INTERVAL) == 0)
+			timeoutExecutor.purge();
+		return timeoutExecutor.schedule(task, timeoutMilliseconds, TimeUnit.MILLISECONDS);
+	}
+
+	static private synchronized ThreadPoolExecutor getRequestWriteExecutor()
+	{
+		if (requestWriteExecutor == null)
+			requestWriteExecutor = new ThreadPoolExecutor(0, Integer.MAX_VALUE, 1, TimeUnit.SECONDS, new SynchronousQueue<Runnable>(), SerialPortThreadFactory.get());
+		return requestWriteExecutor;
+	}
+}
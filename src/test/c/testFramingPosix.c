@@ -0,0 +1,462 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "com_fazecast_jSerialComm_SerialPort.h"
+
+// Minimal JNI environment exposing C arrays as Java primitive arrays
+typedef struct testArray
+{
+	jsize length;
+	unsigned char data[];
+} testArray;
+
+static jsize JNICALL getArrayLength(JNIEnv *env, jarray array) { return ((testArray*)array)->length; }
+static void* JNICALL getPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy) { return ((testArray*)array)->data; }
+static void JNICALL releasePrimitiveArrayCritical(JNIEnv *env, jarray array, void *carray, jint mode) {}
+static struct JNINativeInterface_ nativeInterface;
+static JNIEnv jniEnv;
+static JNIEnv *env = &jniEnv;
+static int numFailures = 0;
+
+static testArray* newArray(jsize length, size_t elementSize)
+{
+	testArray *array = (testArray*)calloc(1, sizeof(testArray) + (length * elementSize) + 1);
+	array->length = length;
+	return array;
+}
+
+static testArray* newByteArray(const void *data, jsize length)
+{
+	testArray *array = newArray(length, 1);
+	if (length)
+		memcpy(array->data, data, length);
+	return array;
+}
+
+static void check(int condition, const char *testName)
+{
+	if (!condition)
+		++numFailures;
+	printf("%s: %s\n", condition ? "PASS" : "FAIL", testName);
+}
+
+static void checkBytes(const unsigned char *actual, jint actualLength, const unsigned char *expected, jint expectedLength, const char *testName)
+{
+	check((actualLength == expectedLength) && (!expectedLength || !memcmp(actual, expected, expectedLength)), testName);
+}
+
+// Brute-force construction of the packed pattern automaton, independent of the breadth-first construction in SerialPortPatternMatcher
+static testArray* newPatternAutomaton(const char **patterns, int numPatterns, int *maxMatchesPerByte)
+{
+	char states[64][16] = { "" };
+	int numStates = 1;
+	for (int i = 0; i < numPatterns; ++i)
+		for (size_t length = 1; length <= strlen(patterns[i]); ++length)
+		{
+			int exists = 0;
+			for (int state = 0; state < numStates; ++state)
+				exists |= (strlen(states[state]) == length) && !strncmp(states[state], patterns[i], length);
+			if (!exists)
+				strncpy(states[numStates++], patterns[i], length);
+		}
+	testArray *array = newArray(numStates * 258, sizeof(jint));
+	jint *transitions = (jint*)array->data, *patternIds = transitions + (numStates * 256), *outputLinks = patternIds + numStates;
+	*maxMatchesPerByte = 1;
+	for (int state = 0; state < numStates; ++state)
+	{
+		// Each transition leads to the longest state that is a suffix of the current state followed by the next byte
+		char next[16];
+		size_t nextLength = strlen(states[state]) + 1;
+		memcpy(next, states[state], nextLength - 1);
+		for (int value = 1; value < 256; ++value)
+		{
+			size_t longestLength = 0;
+			next[nextLength - 1] = (char)value;
+			for (int target = 1; target < numStates; ++target)
+			{
+				size_t targetLength = strlen(states[target]);
+				if ((targetLength <= nextLength) && (targetLength > longestLength) && !memcmp(next + nextLength - targetLength, states[target], targetLength))
+				{
+					transitions[(state << 8) | value] = target;
+					longestLength = targetLength;
+				}
+			}
+		}
+
+		// Each output link leads to the longest proper suffix of the current state that is a complete pattern
+		int numOutputs = 0;
+		patternIds[state] = -1;
+		outputLinks[state] = 0;
+		for (int i = numPatterns - 1; i >= 0; --i)
+			if (!strcmp(states[state], patterns[i]))
+				patternIds[state] = i;
+		for (int target = 0; target < numStates; ++target)
+		{
+			size_t stateLength = strlen(states[state]), targetLength = strlen(states[target]);
+			int isPattern = 0;
+			for (int i = 0; i < numPatterns; ++i)
+				isPattern |= !strcmp(states[target], patterns[i]);
+			if (isPattern && (targetLength <= stateLength) && !strcmp(states[state] + stateLength - targetLength, states[target]))
+			{
+				++numOutputs;
+				if ((targetLength < stateLength) && (targetLength > strlen(states[outputLinks[state]])))
+					outputLinks[state] = target;
+			}
+		}
+		if (numOutputs > *maxMatchesPerByte)
+			*maxMatchesPerByte = numOutputs;
+	}
+	return array;
+}
+
+static jint findPatterns(testArray *automaton, testArray *buffer, jint startIndex, int maxMatchesPerByte, jint state[2], testArray *matches)
+{
+	testArray *stateArray = newArray(2, sizeof(jint));
+	memcpy(stateArray->data, state, 2 * sizeof(jint));
+	jint numMatches = Java_com_fazecast_jSerialComm_SerialPort_findPatterns(env, NULL, (jintArray)automaton, (jbyteArray)buffer, startIndex, buffer->length, maxMatchesPerByte, (jintArray)stateArray, (jintArray)matches);
+	memcpy(state, stateArray->data, 2 * sizeof(jint));
+	free(stateArray);
+	return numMatches;
+}
+
+static void testPatternMatcher(void)
+{
+	// The classic Aho-Corasick example: "ushers" contains "she" and "he" ending at offset 4 and "hers" ending at offset 6
+	static const char *patterns[] = { "he", "she", "his", "hers" };
+	int maxMatchesPerByte;
+	jint state[2] = { 0, 0 };
+	testArray *automaton = newPatternAutomaton(patterns, 4, &maxMatchesPerByte), *matches = newArray(16, sizeof(jint)), *buffer = newByteArray("ushers", 6);
+	jint *results = (jint*)matches->data;
+	check(maxMatchesPerByte == 2, "Pattern matcher overlapping match count");
+	jint numMatches = findPatterns(automaton, buffer, 0, maxMatchesPerByte, state, matches);
+	check((numMatches == 3) && (results[0] == 1) && (results[1] == 4) && (results[2] == 0) && (results[3] == 4) && (results[4] == 3) && (results[5] == 6), "Pattern matcher finds overlapping matches");
+	check(state[1] == 6, "Pattern matcher consumes the entire buffer");
+	free(buffer);
+
+	// A match spanning two buffers must be found using the automaton state carried over from the first buffer
+	state[0] = state[1] = 0;
+	buffer = newByteArray("xxhi", 4);
+	check(findPatterns(automaton, buffer, 0, maxMatchesPerByte, state, matches) == 0, "Pattern matcher finds no match in partial pattern");
+	free(buffer);
+	buffer = newByteArray("s", 1);
+	check((findPatterns(automaton, buffer, 0, maxMatchesPerByte, state, matches) == 1) && (results[0] == 2) && (results[1] == 1), "Pattern matcher resumes across buffers");
+	free(buffer);
+
+	// Scanning must stop before a byte whose matches could overflow the match array, leaving the remaining bytes for the next call
+	free(matches);
+	matches = newArray(6, sizeof(jint));
+	results = (jint*)matches->data;
+	state[0] = state[1] = 0;
+	buffer = newByteArray("sheshe", 6);
+	check((findPatterns(automaton, buffer, 0, maxMatchesPerByte, state, matches) == 2) && (state[1] == 3), "Pattern matcher stops before overflowing its match array");
+	check((findPatterns(automaton, buffer, state[1], maxMatchesPerByte, state, matches) == 2) && (results[1] == 6) && (results[3] == 6), "Pattern matcher continues after a full match array");
+	free(buffer);
+	free(matches);
+	free(automaton);
+}
+
+static jint findLengthFieldFrames(testArray *buffer, jint startIndex, const char *syncWord, jint syncLength, const jint format[5], jint state[4], jint frames[8])
+{
+	testArray *sync = newByteArray(syncWord, syncLength), *formatArray = newArray(5, sizeof(jint)), *stateArray = newArray(4, sizeof(jint)), *framesArray = newArray(8, sizeof(jint));
+	memcpy(formatArray->data, format, 5 * sizeof(jint));
+	jint numFrames = Java_com_fazecast_jSerialComm_SerialPort_findLengthFieldFrames(env, NULL, (jbyteArray)buffer, startIndex, buffer->length, (jbyteArray)sync, (jintArray)formatArray, (jintArray)stateArray, (jintArray)framesArray);
+	memcpy(state, stateArray->data, 4 * sizeof(jint));
+	memcpy(frames, framesArray->data, 8 * sizeof(jint));
+	free(framesArray);
+	free(stateArray);
+	free(formatArray);
+	free(sync);
+	return numFrames;
+}
+
+static void testLengthFieldFramer(void)
+{
+	// Frames of the form [AA 55][length:u16le][payload], preceded by two bytes of line noise that must be discarded
+	static const jint format[5] = { 2, 2, 0, 0, 64 };
+	static const unsigned char stream[] = { 0x01, 0x02, 0xAA, 0x55, 0x03, 0x00, 0x11, 0x22, 0x33, 0xAA, 0x55, 0x00, 0x00, 0xAA, 0x55, 0x02 };
+	jint state[4], frames[8];
+	testArray *buffer = newByteArray(stream, sizeof(stream));
+	jint numFrames = findLengthFieldFrames(buffer, 0, "\xAA\x55", 2, format, state, frames);
+	check((numFrames == 2) && (frames[0] == 2) && (frames[1] == 7) && (frames[2] == 9) && (frames[3] == 4), "Length-field framer resynchronizes on the sync word");
+	check((state[0] == 13) && (state[1] == 2) && (state[2] == 0) && (state[3] == 1), "Length-field framer counts discarded bytes and sync losses");
+	free(buffer);
+
+	// A truncated length header must wait for more data without discarding anything
+	buffer = newByteArray("\xAA\x55\x03", 3);
+	check((findLengthFieldFrames(buffer, 0, "\xAA\x55", 2, format, state, frames) == 0) && (state[0] == 0) && (state[1] == 0), "Length-field framer waits for a truncated header");
+	free(buffer);
+
+	// A partial sync word at the end of the buffer must be retained, and an implausible length must trigger resynchronization
+	buffer = newByteArray("\x01\x02\xAA", 3);
+	check((findLengthFieldFrames(buffer, 0, "\xAA\x55", 2, format, state, frames) == 0) && (state[0] == 2) && (state[1] == 2) && (state[2] == 1), "Length-field framer keeps a partial sync word");
+	free(buffer);
+	buffer = newByteArray("\xAA\x55\xFF\x00\xAA\x55\x00\x00", 8);
+	check((findLengthFieldFrames(buffer, 0, "\xAA\x55", 2, format, state, frames) == 1) && (frames[0] == 4) && (frames[1] == 4) && (state[1] == 4), "Length-field framer rejects oversized frames");
+	free(buffer);
+
+	// Without a sync word, a big-endian length field that counts the entire frame is resynchronized by plausibility alone
+	static const jint selfFormat[5] = { 0, 2, 1, -2, 16 };
+	buffer = newByteArray("\x00\x01\x00\x03\x7F\x00\x02", 7);
+	numFrames = findLengthFieldFrames(buffer, 0, "", 0, selfFormat, state, frames);
+	check((numFrames == 2) && (frames[0] == 2) && (frames[1] == 3) && (frames[2] == 5) && (frames[3] == 2) && (state[0] == 7) && (state[1] == 2), "Length-field framer without sync word");
+	free(buffer);
+}
+
+static void testCobs(void)
+{
+	// Encoding examples from Cheshire and Baker, "Consistent Overhead Byte Stuffing", including the 254-byte non-zero run boundaries
+	static const unsigned char example1[] = { 0x00 }, encoded1[] = { 0x01, 0x01, 0x00 };
+	static const unsigned char example2[] = { 0x00, 0x00 }, encoded2[] = { 0x01, 0x01, 0x01, 0x00 };
+	static const unsigned char example3[] = { 0x00, 0x11, 0x00 }, encoded3[] = { 0x01, 0x02, 0x11, 0x01, 0x00 };
+	static const unsigned char example4[] = { 0x11, 0x22, 0x00, 0x33 }, encoded4[] = { 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 };
+	static const unsigned char example5[] = { 0x11, 0x22, 0x33, 0x44 }, encoded5[] = { 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 };
+	static const unsigned char example6[] = { 0x11, 0x00, 0x00, 0x00 }, encoded6[] = { 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 };
+	static const unsigned char emptyEncoded[] = { 0x01, 0x00 };
+	const struct { const unsigned char *data, *encoded; jint length, encodedLength; const char *name; } examples[] = {
+		{ example1, encoded1, sizeof(example1), sizeof(encoded1), "COBS example 00" },
+		{ example2, encoded2, sizeof(example2), sizeof(encoded2), "COBS example 00 00" },
+		{ example3, encoded3, sizeof(example3), sizeof(encoded3), "COBS example 00 11 00" },
+		{ example4, encoded4, sizeof(example4), sizeof(encoded4), "COBS example 11 22 00 33" },
+		{ example5, encoded5, sizeof(example5), sizeof(encoded5), "COBS example 11 22 33 44" },
+		{ example6, encoded6, sizeof(example6), sizeof(encoded6), "COBS example 11 00 00 00" },
+		{ example1, emptyEncoded, 0, sizeof(emptyEncoded), "COBS empty frame" }
+	};
+
+	// Build the long examples: 01..FE, 00 01..FE, 01..FF, 02..FF 00, and 03..FF 00 01
+	unsigned char longData[5][255], longEncoded[5][258];
+	jint longLengths[5] = { 254, 255, 255, 255, 255 }, longEncodedLengths[5] = { 256, 257, 258, 258, 257 };
+	for (int i = 0; i < 255; ++i)
+	{
+		longData[0][i] = (unsigned char)(i + 1);
+		longData[1][i] = (unsigned char)i;
+		longData[2][i] = (unsigned char)(i + 1);
+		longData[3][i] = (unsigned char)(i + 2);
+		longData[4][i] = (unsigned char)(i + 3);
+	}
+	longEncoded[0][0] = 0xFF;
+	memcpy(longEncoded[0] + 1, longData[0], 254);
+	longEncoded[0][255] = 0x00;
+	longEncoded[1][0] = 0x01;
+	longEncoded[1][1] = 0xFF;
+	memcpy(longEncoded[1] + 2, longData[1] + 1, 254);
+	longEncoded[1][256] = 0x00;
+	longEncoded[2][0] = 0xFF;
+	memcpy(longEncoded[2] + 1, longData[2], 254);
+	memcpy(longEncoded[2] + 255, "\x02\xFF\x00", 3);
+	longEncoded[3][0] = 0xFF;
+	memcpy(longEncoded[3] + 1, longData[3], 254);
+	memcpy(longEncoded[3] + 255, "\x01\x01\x00", 3);
+	longEncoded[4][0] = 0xFE;
+	memcpy(longEncoded[4] + 1, longData[4], 253);
+	memcpy(longEncoded[4] + 254, "\x02\x01\x00", 3);
+
+	// Encode each example, then decode the encoding without its trailing delimiter in place
+	char testName[64];
+	for (int i = 0; i < 12; ++i)
+	{
+		const unsigned char *data = (i < 7) ? examples[i].data : longData[i - 7], *expected = (i < 7) ? examples[i].encoded : longEncoded[i - 7];
+		jint length = (i < 7) ? examples[i].length : longLengths[i - 7], expectedLength = (i < 7) ? examples[i].encodedLength : longEncodedLengths[i - 7];
+		testArray *input = newByteArray(data, length), *output = newArray(length + (length / 254) + 2, 1);
+		if (i < 7)
+			snprintf(testName, sizeof(testName), "%s", examples[i].name);
+		else
+			snprintf(testName, sizeof(testName), "COBS 254-byte run example %d", i - 6);
+		jint encodedLength = Java_com_fazecast_jSerialComm_SerialPort_encodeCobs(env, NULL, (jbyteArray)input, 0, length, (jbyteArray)output);
+		checkBytes(output->data, encodedLength, expected, expectedLength, testName);
+		jint decodedLength = Java_com_fazecast_jSerialComm_SerialPort_decodeCobs(env, NULL, (jbyteArray)output, 0, encodedLength - 1);
+		strncat(testName, " round trip", sizeof(testName) - strlen(testName) - 1);
+		checkBytes(output->data, decodedLength, data, length, testName);
+		free(output);
+		free(input);
+	}
+
+	// Reject an undersized output buffer, a code byte running past the end of the frame, and an embedded zero byte
+	testArray *input = newByteArray(longData[0], 254), *output = newArray(255, 1);
+	check(Java_com_fazecast_jSerialComm_SerialPort_encodeCobs(env, NULL, (jbyteArray)input, 0, 254, (jbyteArray)output) == -1, "COBS rejects undersized output buffer");
+	free(output);
+	free(input);
+	input = newByteArray("\x03\x11", 2);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeCobs(env, NULL, (jbyteArray)input, 0, 2) == -1, "COBS rejects truncated block");
+	free(input);
+	input = newByteArray("\x02\x11\x00\x01", 4);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeCobs(env, NULL, (jbyteArray)input, 0, 4) == -1, "COBS rejects embedded zero code");
+	free(input);
+}
+
+static void testSlip(void)
+{
+	// RFC 1055 escapes END (C0) as DB DC and ESC (DB) as DB DD, with END bytes at both ends of the frame
+	static const unsigned char data[] = { 0xC0, 0x01, 0xDB }, encoded[] = { 0xC0, 0xDB, 0xDC, 0x01, 0xDB, 0xDD, 0xC0 };
+	testArray *input = newByteArray(data, sizeof(data)), *output = newArray((2 * sizeof(data)) + 2, 1);
+	jint encodedLength = Java_com_fazecast_jSerialComm_SerialPort_encodeSlip(env, NULL, (jbyteArray)input, 0, sizeof(data), (jbyteArray)output);
+	checkBytes(output->data, encodedLength, encoded, sizeof(encoded), "SLIP escapes END and ESC");
+	jint decodedLength = Java_com_fazecast_jSerialComm_SerialPort_decodeSlip(env, NULL, (jbyteArray)output, 1, encodedLength - 2);
+	checkBytes(output->data + 1, decodedLength, data, sizeof(data), "SLIP round trip with escapes at both buffer edges");
+	free(output);
+	free(input);
+
+	// An ESC as the final byte of the buffer or followed by anything other than DC or DD is a protocol violation
+	input = newByteArray("\x01\x02\xDB", 3);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeSlip(env, NULL, (jbyteArray)input, 0, 3) == -1, "SLIP rejects ESC at end of buffer");
+	free(input);
+	input = newByteArray("\xDB\xDC\xDB", 3);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeSlip(env, NULL, (jbyteArray)input, 0, 2) == 1 && (input->data[0] == 0xC0), "SLIP ignores bytes beyond the frame length");
+	free(input);
+	input = newByteArray("\xDB\x01", 2);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeSlip(env, NULL, (jbyteArray)input, 0, 2) == -1, "SLIP rejects invalid escape sequence");
+	free(input);
+}
+
+static void testHdlc(void)
+{
+	// The FCS of "123456789" is 0x906E for FCS-16 and 0xCBF43926 for FCS-32, transmitted least significant byte first
+	static const unsigned char encoded16[] = { 0x7E, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x6E, 0x90, 0x7E };
+	static const unsigned char encoded32[] = { 0x7E, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x26, 0x39, 0xF4, 0xCB, 0x7E };
+	testArray *input = newByteArray("123456789", 9), *output = newArray(32, 1);
+	jint encodedLength = Java_com_fazecast_jSerialComm_SerialPort_encodeHdlc(env, NULL, (jbyteArray)input, 0, 9, 0, 16, (jbyteArray)output);
+	checkBytes(output->data, encodedLength, encoded16, sizeof(encoded16), "HDLC FCS-16 frame");
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)output, 1, encodedLength - 2, 0, 16) == 9, "HDLC FCS-16 good residue 0xF0B8");
+	encodedLength = Java_com_fazecast_jSerialComm_SerialPort_encodeHdlc(env, NULL, (jbyteArray)input, 0, 9, 0, 32, (jbyteArray)output);
+	checkBytes(output->data, encodedLength, encoded32, sizeof(encoded32), "HDLC FCS-32 frame");
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)output, 1, encodedLength - 2, 0, 32) == 9, "HDLC FCS-32 good residue 0xDEBB20E3");
+	output->data[5] ^= 0x01;
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)output, 1, encodedLength - 2, 0, 32) == -2, "HDLC FCS-32 detects corrupted byte");
+	free(output);
+	free(input);
+
+	// Flag, control-escape, and ACCM-selected control characters are escaped, and received ACCM characters are discarded
+	static const unsigned char data[] = { 0x7E, 0x7D, 0x01, 0x41 }, escaped[] = { 0x7E, 0x7D, 0x5E, 0x7D, 0x5D, 0x7D, 0x21, 0x41, 0x7E };
+	input = newByteArray(data, sizeof(data));
+	output = newArray(32, 1);
+	encodedLength = Java_com_fazecast_jSerialComm_SerialPort_encodeHdlc(env, NULL, (jbyteArray)input, 0, sizeof(data), 0xFFFFFFFF, 0, (jbyteArray)output);
+	checkBytes(output->data, encodedLength, escaped, sizeof(escaped), "HDLC escapes flag, escape, and ACCM characters");
+	output->data[encodedLength - 1] = 0x11;
+	jint decodedLength = Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)output, 1, encodedLength - 1, 0x00020000, 0);
+	checkBytes(output->data + 1, decodedLength, data, sizeof(data), "HDLC round trip discarding received ACCM characters");
+	free(output);
+	free(input);
+	input = newByteArray("\x41\x7D", 2);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)input, 0, 2, 0, 0) == -1, "HDLC rejects escape at end of buffer");
+	free(input);
+	input = newByteArray("\x41", 1);
+	check(Java_com_fazecast_jSerialComm_SerialPort_decodeHdlc(env, NULL, (jbyteArray)input, 0, 1, 0, 16) == -2, "HDLC rejects frame shorter than its FCS");
+	free(input);
+}
+
+// CRC engine mirroring the SerialPortCrc table generation and register conventions
+typedef struct crcModel
+{
+	const char *name;
+	int width;
+	uint32_t polynomial, initialValue, finalXorValue, check;
+	int reflectInput, reflectOutput;
+} crcModel;
+
+static uint32_t reflectBits(uint32_t value, int numBits)
+{
+	uint32_t reflected = 0;
+	for (int bit = 0; bit < numBits; ++bit)
+		if (value & (1U << bit))
+			reflected |= 1U << (numBits - 1 - bit);
+	return reflected;
+}
+
+static testArray* newCrcTables(const crcModel *model)
+{
+	testArray *array = newArray(2048, sizeof(jint));
+	uint32_t *tables = (uint32_t*)array->data;
+	if (model->reflectInput)
+	{
+		uint32_t reflectedPolynomial = reflectBits(model->polynomial, model->width);
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t crc = i;
+			for (int bit = 0; bit < 8; ++bit)
+				crc = (crc & 1) ? ((crc >> 1) ^ reflectedPolynomial) : (crc >> 1);
+			tables[i] = crc;
+		}
+		for (int k = 1; k < 8; ++k)
+			for (int i = 0; i < 256; ++i)
+				tables[(256 * k) + i] = (tables[(256 * (k - 1)) + i] >> 8) ^ tables[tables[(256 * (k - 1)) + i] & 0xFF];
+	}
+	else
+	{
+		uint32_t alignedPolynomial = model->polynomial << (32 - model->width);
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t crc = i << 24;
+			for (int bit = 0; bit < 8; ++bit)
+				crc = (crc & 0x80000000U) ? ((crc << 1) ^ alignedPolynomial) : (crc << 1);
+			tables[i] = crc;
+		}
+		for (int k = 1; k < 8; ++k)
+			for (int i = 0; i < 256; ++i)
+				tables[(256 * k) + i] = (tables[(256 * (k - 1)) + i] << 8) ^ tables[tables[(256 * (k - 1)) + i] >> 24];
+	}
+	return array;
+}
+
+static uint32_t calculateCrc(const crcModel *model, testArray *tables, testArray *data, jint splitIndex)
+{
+	// Optionally split the calculation in two to verify that the CRC register can be continued across calls
+	uint32_t mask = (model->width == 32) ? 0xFFFFFFFFU : ((1U << model->width) - 1);
+	uint32_t initial = model->reflectInput ? reflectBits(model->initialValue, model->width) : model->initialValue;
+	jint crc = (jint)(model->reflectInput ? initial : (initial << (32 - model->width)));
+	crc = Java_com_fazecast_jSerialComm_SerialPort_updateCrc(env, NULL, (jintArray)tables, model->reflectInput, crc, (jbyteArray)data, 0, splitIndex);
+	crc = Java_com_fazecast_jSerialComm_SerialPort_updateCrc(env, NULL, (jintArray)tables, model->reflectInput, crc, (jbyteArray)data, splitIndex, data->length - splitIndex);
+	uint32_t value = model->reflectInput ? ((uint32_t)crc & mask) : (((uint32_t)crc >> (32 - model->width)) & mask);
+	if (model->reflectInput != model->reflectOutput)
+		value = reflectBits(value, model->width);
+	return (value ^ model->finalXorValue) & mask;
+}
+
+static void testCrc(void)
+{
+	// Check values for "123456789" from the CRC RevEng catalogue, covering reflected and non-reflected algorithms of several widths
+	static const crcModel models[] = {
+		{ "CRC-8/SMBUS", 8, 0x07, 0x00, 0x00, 0xF4, 0, 0 },
+		{ "CRC-16/MODBUS", 16, 0x8005, 0xFFFF, 0x0000, 0x4B37, 1, 1 },
+		{ "CRC-16/IBM-3740", 16, 0x1021, 0xFFFF, 0x0000, 0x29B1, 0, 0 },
+		{ "CRC-16/KERMIT", 16, 0x1021, 0x0000, 0x0000, 0x2189, 1, 1 },
+		{ "CRC-16/XMODEM", 16, 0x1021, 0x0000, 0x0000, 0x31C3, 0, 0 },
+		{ "CRC-16/IBM-SDLC", 16, 0x1021, 0xFFFF, 0xFFFF, 0x906E, 1, 1 },
+		{ "CRC-32/ISO-HDLC", 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926, 1, 1 },
+		{ "CRC-32/ISCSI", 32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, 0xE3069283, 1, 1 },
+		{ "CRC-32/BZIP2", 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFC891918, 0, 0 }
+	};
+	testArray *data = newByteArray("123456789", 9);
+	char testName[64];
+	for (size_t i = 0; i < (sizeof(models) / sizeof(models[0])); ++i)
+	{
+		testArray *tables = newCrcTables(models + i);
+		snprintf(testName, sizeof(testName), "%s check value", models[i].name);
+		check(calculateCrc(models + i, tables, data, 0) == models[i].check, testName);
+		snprintf(testName, sizeof(testName), "%s check value split at byte 3", models[i].name);
+		check(calculateCrc(models + i, tables, data, 3) == models[i].check, testName);
+		free(tables);
+	}
+
+	// A range whose end overflows a jint must be rejected without reading past the end of the array
+	testArray *tables = newCrcTables(models + 1);
+	check(Java_com_fazecast_jSerialComm_SerialPort_updateCrc(env, NULL, (jintArray)tables, JNI_TRUE, 0x1234, (jbyteArray)data, 1, 0x7FFFFFFF) == 0x1234, "CRC rejects an overflowing range");
+	free(tables);
+	free(data);
+}
+
+int main(void)
+{
+	// Set up the JNI environment and run all known-answer tests
+	nativeInterface.GetArrayLength = getArrayLength;
+	nativeInterface.GetPrimitiveArrayCritical = getPrimitiveArrayCritical;
+	nativeInterface.ReleasePrimitiveArrayCritical = releasePrimitiveArrayCritical;
+	jniEnv = &nativeInterface;
+	testPatternMatcher();
+	testLengthFieldFramer();
+	testCobs();
+	testSlip();
+	testHdlc();
+	testCrc();
+	printf("\n%d test(s) failed\n", numFailures);
+	return numFailures ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * SerialPortTransactionTest.java
+ *
+ *       Created on:  Oct 18, 2026
+ *  Last Updated on:  Oct 18, 2026
+ *           Author:  Will Hedgecock
+ *
+ * Copyright (C) 2012-2026 Fazecast, Inc.
+ *
+ * This file is part of jSerialComm.
+ *
+ * jSerialComm is free software: you can redistribute it and/or modify
+ * it under the terms of either the Apache Software License, version 2, or
+ * the GNU Lesser General Public License as published by the Free Software
+ * Foundation, version 3 or above.
+ *
+ * jSerialComm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of both the GNU Lesser General Public
+ * License and the Apache Software License along with jSerialComm. If not,
+ * see <http://www.gnu.org/licenses/> and <http://www.apache.org/licenses/>.
+ */
+
+package com.fazecast.jSerialComm;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * This class tests the transaction queue and poll scheduler of the jSerialComm library using a serial port whose transmit line is looped back
+ * to its receive line, so that every request is received as its own response.
+ *
+ * @see com.fazecast.jSerialComm.SerialPortTransaction
+ * @see com.fazecast.jSerialComm.SerialPortPollScheduler
+ */
+public class SerialPortTransactionTest
+{
+	private static int numFailures = 0;
+
+	private static final class PacketMatcher implements SerialPortResponseMatcher, SerialPortPacketListener
+	{
+		private final int packetSize, correlationLength, maxOutstandingTransactions;
+		public volatile int numUnsolicitedFrames = 0;
+		public PacketMatcher(int packetSize, int correlationLength, int maxOutstandingTransactions)
+		{
+			this.packetSize = packetSize;
+			this.correlationLength = correlationLength;
+			this.maxOutstandingTransactions = maxOutstandingTransactions;
+		}
+		@Override
+		public int getListeningEvents() { return SerialPort.LISTENING_EVENT_DATA_RECEIVED; }
+		@Override
+		public void serialEvent(SerialPortEvent event) { ++numUnsolicitedFrames; }
+		@Override
+		public int getPacketSize() { return packetSize; }
+		@Override
+		public int getCorrelationOffset() { return 0; }
+		@Override
+		public int getCorrelationLength() { return correlationLength; }
+		@Override
+		public int getMaxOutstandingTransactions() { return maxOutstandingTransactions; }
+	}
+
+	private static class PollRecorder implements SerialPortPollListener
+	{
+		public final List<Integer> completedAddresses = new ArrayList<Integer>(), failedAddresses = new ArrayList<Integer>();
+		public volatile boolean responsesMatched = true;
+		@Override
+		public synchronized void pollCompleted(SerialPortPollJob job, byte[] response)
+		{
+			completedAddresses.add(job.getAddress());
+			responsesMatched &= Arrays.equals(job.getRequest(), response);
+		}
+		@Override
+		public synchronized void pollFailed(SerialPortPollJob job, Exception cause)
+		{
+			failedAddresses.add(job.getAddress());
+			if (!(cause instanceof SerialPortTimeoutException))
+				responsesMatched = false;
+		}
+	}
+
+	private static void check(boolean condition, String testName)
+	{
+		if (!condition)
+			++numFailures;
+		System.out.println((condition ? "PASS: " : "FAIL: ") + testName);
+	}
+
+	private static Throwable getFailure(SerialPortTransaction transaction)
+	{
+		try { transaction.get(5, TimeUnit.SECONDS); }
+		catch (ExecutionException e) { return e.getCause(); }
+		catch (Exception e) { return e; }
+		return null;
+	}
+
+	private static void testTransactions(SerialPort comPort) throws Exception
+	{
+		// Pipeline requests whose first byte is a sequence number, completing each one with its own looped-back copy
+		PacketMatcher pipelinedMatcher = new PacketMatcher(4, 1, 4);
+		SerialPortTransaction[] transactions = new SerialPortTransaction[16];
+		for (int i = 0; i < transactions.length; ++i)
+			transactions[i] = comPort.transact(new byte[]{ (byte)i, 0x11, 0x22, (byte)(0x33 + i) }, pipelinedMatcher, 1000);
+		boolean allMatched = true, timestampsOrdered = true;
+		for (int i = 0; i < transactions.length; ++i)
+		{
+			allMatched &= Arrays.equals(transactions[i].get(5, TimeUnit.SECONDS), transactions[i].getRequest());
+			timestampsOrdered &= (transactions[i].getRequestTimestamp() != 0) && (transactions[i].getResponseTimestamp() >= transactions[i].getRequestTimestamp());
+		}
+		check(allMatched, "Pipelined transactions complete with their matching responses");
+		check(timestampsOrdered, "Transaction responses are timestamped after their requests");
+		check(pipelinedMatcher.numUnsolicitedFrames == 0, "Matched responses are not delivered as unsolicited frames");
+
+		// Reject a request that is too short to contain its correlation field without writing it
+		PacketMatcher correlatedMatcher = new PacketMatcher(4, 2, 2);
+		check(getFailure(comPort.transact(new byte[]{ 0x01 }, correlatedMatcher, 100)) instanceof SerialPortIOException, "Requests shorter than the correlation field fail");
+		comPort.removeDataListener(correlatedMatcher);
+
+		// Cancel a transaction that is still waiting behind an outstanding one, which must not stop the following transaction
+		PacketMatcher sequentialMatcher = new PacketMatcher(4, 1, 1);
+		SerialPortTransaction first = comPort.transact(new byte[]{ 0x01, 0x02, 0x03, 0x04 }, sequentialMatcher, 1000);
+		SerialPortTransaction second = comPort.transact(new byte[]{ 0x05, 0x06, 0x07, 0x08 }, sequentialMatcher, 1000);
+		SerialPortTransaction third = comPort.transact(new byte[]{ 0x09, 0x0A, 0x0B, 0x0C }, sequentialMatcher, 1000);
+		check(second.cancel(false) && second.isCancelled(), "Waiting transactions can be cancelled");
+		check(Arrays.equals(first.get(5, TimeUnit.SECONDS), first.getRequest()) && Arrays.equals(third.get(5, TimeUnit.SECONDS), third.getRequest()), "Sequential transactions skip cancelled requests");
+		comPort.removeDataListener(sequentialMatcher);
+		comPort.removeDataListener(pipelinedMatcher);
+
+		// A response that never completes a frame must time out, and removing the matcher must fail any remaining transactions
+		PacketMatcher incompleteMatcher = new PacketMatcher(64, 0, 1);
+		long startTime = System.nanoTime();
+		check(getFailure(comPort.transact(new byte[]{ 0x01, 0x02 }, incompleteMatcher, 100)) instanceof SerialPortTimeoutException, "Unanswered transactions time out");
+		check((System.nanoTime() - startTime) >= 100000000L, "Transactions do not time out early");
+		SerialPortTransaction orphaned = comPort.transact(new byte[]{ 0x03, 0x04 }, incompleteMatcher, 10000);
+		comPort.removeDataListener(incompleteMatcher);
+		check(getFailure(orphaned) instanceof SerialPortIOException, "Removing a matcher fails its outstanding transactions");
+		comPort.flushIOBuffers();
+	}
+
+	private static void testPollScheduler(SerialPort comPort) throws Exception
+	{
+		// Poll two slaves whose requests are looped back as their responses
+		PollRecorder recorder = new PollRecorder();
+		PacketMatcher pollMatcher = new PacketMatcher(4, 0, 1);
+		SerialPortPollScheduler scheduler = new SerialPortPollScheduler(comPort, pollMatcher, recorder);
+		scheduler.setResponseTimeout(500);
+		scheduler.addJob(new SerialPortPollJob(1, new byte[]{ 0x01, 0x03, 0x00, 0x01 }, 50, 1));
+		scheduler.addJob(new SerialPortPollJob(2, new byte[]{ 0x02, 0x03, 0x00, 0x02 }, 100, 2));
+		check(scheduler.start() && !scheduler.start(), "Poll scheduler starts only once");
+		Thread.sleep(1000);
+		scheduler.stop();
+		comPort.removeDataListener(pollMatcher);
+		check(!scheduler.isRunning(), "Poll scheduler stops");
+		SerialPortPollStatistics first = scheduler.getStatistics(1), second = scheduler.getStatistics(2);
+		check((first != null) && (second != null) && (first.getPollCount() > second.getPollCount()) && (second.getPollCount() > 0), "Poll scheduler polls each job at its own rate");
+		check((first.getResponseCount() == first.getPollCount()) && (first.getTimeoutCount() == 0) && (first.getRetryCount() == 0), "Poll scheduler counts successful polls");
+		check((first.getMinimumLatencyNanos() > 0) && (first.getMinimumLatencyNanos() <= first.getAverageLatencyNanos()) && (first.getAverageLatencyNanos() <= first.getMaximumLatencyNanos()), "Poll scheduler tracks response latency");
+		check(recorder.responsesMatched && recorder.failedAddresses.isEmpty(), "Poll listener receives each looped-back response");
+
+		// A slave that never answers must be retried and then reported as failed, while a listener exception must not stop polling
+		PollRecorder failingRecorder = new PollRecorder()
+		{
+			@Override
+			public synchronized void pollFailed(SerialPortPollJob job, Exception cause)
+			{
+				super.pollFailed(job, cause);
+				throw new IllegalStateException("Listener failure");
+			}
+		};
+		PacketMatcher incompleteMatcher = new PacketMatcher(64, 0, 1);
+		scheduler = new SerialPortPollScheduler(comPort, incompleteMatcher, failingRecorder);
+		scheduler.setResponseTimeout(50);
+		scheduler.setMaxRetries(1);
+		scheduler.addJob(new SerialPortPollJob(3, new byte[]{ 0x03, 0x03, 0x00, 0x01 }, 500, 1));
+		scheduler.start();
+		Thread.sleep(1200);
+		scheduler.stop();
+		comPort.removeDataListener(incompleteMatcher);
+		comPort.flushIOBuffers();
+		SerialPortPollStatistics third = scheduler.getStatistics(3);
+		check((third != null) && (third.getPollCount() >= 2) && (third.getFailureCount() == third.getPollCount()), "Poll scheduler reports unanswered polls as failed");
+		check((third.getRetryCount() == third.getPollCount()) && (third.getTimeoutCount() == (2 * third.getPollCount())), "Poll scheduler retries timed-out polls");
+		check(failingRecorder.failedAddresses.size() == third.getPollCount(), "Poll scheduler keeps polling after a listener exception");
+	}
+
+	static public void main(String[] args)
+	{
+		// Ensure that a looped-back port was specified
+		if (args.length != 1)
+		{
+			System.out.println("Usage: java com.fazecast.jSerialComm.SerialPortTransactionTest <looped-back port descriptor>");
+			return;
+		}
+		SerialPort comPort = SerialPort.getCommPort(args[0]);
+		check(getFailure(comPort.transact(new byte[]{ 0x01 }, new PacketMatcher(1, 0, 1), 100)) instanceof SerialPortIOException, "Transactions fail on a closed port");
+		comPort.removeDataListener();
+		comPort.setComPortParameters(115200, 8, SerialPort.ONE_STOP_BIT, SerialPort.NO_PARITY);
+		if (!comPort.openPort())
+		{
+			System.out.println("Unable to open " + comPort.getSystemPortPath());
+			System.exit(1);
+		}
+		try
+		{
+			comPort.flushIOBuffers();
+			testTransactions(comPort);
+			testPollScheduler(comPort);
+		}
+		catch (Exception e)
+		{
+			++numFailures;
+			e.printStackTrace();
+		}
+		comPort.closePort();
+		System.out.println("\n" + numFailures + " test(s) failed");
+		System.exit((numFailures == 0) ? 0 : 1);
+	}
+}